@@ -52,7 +52,7 @@ for cores in "${CORES[@]}"; do
     COMPARISON_FILE="output/comparison/all_policies_${cores}cores.csv"
     
     # Criar cabeçalho
-    echo "policy,avg_waiting_time,avg_turnaround_time,cpu_utilization,throughput,efficiency,num_processes,total_cycles" > "$COMPARISON_FILE"
+    echo "policy,avg_waiting_time,avg_turnaround_time,cpu_utilization,throughput,efficiency,num_processes,total_cycles,energy_joules,edp" > "$COMPARISON_FILE"
     
     # Agregar dados de cada política para este número de cores
     for policy in "${POLICIES[@]}"; do
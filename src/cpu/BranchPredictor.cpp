@@ -0,0 +1,138 @@
+#include "BranchPredictor.hpp"
+
+// --------------------------------------------------
+// Construtor — contadores começam em "fracamente não tomado"
+// --------------------------------------------------
+BranchPredictor::BranchPredictor(const BranchPredictorConfig &cfg)
+    : config(cfg)
+{
+    if (config.tableBits == 0) config.tableBits = 1;
+    if (config.tableBits > 20) config.tableBits = 20;
+    if (config.historyBits > config.tableBits) config.historyBits = config.tableBits;
+
+    size_t entries = size_t(1) << config.tableBits;
+    bimodal.assign(entries, 1);
+    gshare.assign(entries, 1);
+    chooser.assign(entries, 1);
+    btb.assign(config.btbEntries, BTBEntry());
+    ras.assign(config.rasDepth, 0);
+}
+
+void BranchPredictor::train(uint8_t &counter, bool taken) {
+    if (taken && counter < 3) counter++;
+    else if (!taken && counter > 0) counter--;
+}
+
+bool BranchPredictor::predictDirection(uint32_t pc, uint32_t history) const {
+    bool bim = bimodal[pc & tableMask()] >= 2;
+    bool gsh = gshare[gshareIndex(pc, history)] >= 2;
+
+    switch (config.type) {
+        case BranchPredictorType::STATIC_NOT_TAKEN: return false;
+        case BranchPredictorType::BIMODAL:          return bim;
+        case BranchPredictorType::GSHARE:           return gsh;
+        case BranchPredictorType::TOURNAMENT:
+            return chooser[pc & tableMask()] >= 2 ? gsh : bim;
+    }
+    return false;
+}
+
+const BranchPredictor::BTBEntry* BranchPredictor::lookupBTB(uint32_t pc) const {
+    if (btb.empty()) return nullptr;
+    const BTBEntry &e = btb[pc % btb.size()];
+    return (e.valid && e.pc == pc) ? &e : nullptr;
+}
+
+// --------------------------------------------------
+// RAS
+// --------------------------------------------------
+void BranchPredictor::pushReturn(uint32_t address) {
+    if (ras.empty()) return;
+    ras[rasTop] = address;
+    rasTop = (rasTop + 1) % ras.size();
+    if (rasCount < ras.size()) rasCount++;
+}
+
+bool BranchPredictor::popReturn(uint32_t &address) {
+    if (rasCount == 0) return false;
+    rasTop = (rasTop + ras.size() - 1) % ras.size();
+    rasCount--;
+    address = ras[rasTop];
+    return true;
+}
+
+// --------------------------------------------------
+// PREDICT (busca)
+// --------------------------------------------------
+// Sem preditor (STATIC_NOT_TAKEN) nada é redirecionado: todo desvio
+// tomado é resolvido no EX com flush, como no pipeline original.
+BranchPrediction BranchPredictor::predict(uint32_t pc, BranchKind kind) {
+    BranchPrediction p;
+    p.history = globalHistory;
+
+    if (kind == BranchKind::NONE || config.type == BranchPredictorType::STATIC_NOT_TAKEN)
+        return p;
+
+    const BTBEntry* e = lookupBTB(pc);
+    p.btbHit = (e != nullptr);
+
+    switch (kind) {
+        case BranchKind::CONDITIONAL:
+            p.taken = e && predictDirection(pc, globalHistory);
+            break;
+        case BranchKind::JUMP:
+            p.taken = (e != nullptr);
+            break;
+        case BranchKind::CALL:
+            p.taken = (e != nullptr);
+            pushReturn(pc + 1);
+            break;
+        case BranchKind::RETURN: {
+            uint32_t ret;
+            if (popReturn(ret)) {
+                p.taken = true;
+                p.target = ret;
+                return p;
+            }
+            p.taken = (e != nullptr);
+            break;
+        }
+        case BranchKind::NONE:
+            break;
+    }
+
+    if (p.taken) p.target = e->target;
+    return p;
+}
+
+// --------------------------------------------------
+// UPDATE (resolução no EX)
+// --------------------------------------------------
+void BranchPredictor::update(uint32_t pc, BranchKind kind, const BranchPrediction &pred,
+                             bool taken, uint32_t target) {
+    if (kind == BranchKind::NONE || config.type == BranchPredictorType::STATIC_NOT_TAKEN)
+        return;
+
+    if (kind == BranchKind::CONDITIONAL) {
+        uint8_t &bim = bimodal[pc & tableMask()];
+        uint8_t &gsh = gshare[gshareIndex(pc, pred.history)];
+
+        // Seletor aprende só quando os dois discordam
+        bool bimRight = (bim >= 2) == taken;
+        bool gshRight = (gsh >= 2) == taken;
+        if (bimRight != gshRight)
+            train(chooser[pc & tableMask()], gshRight);
+
+        train(bim, taken);
+        train(gsh, taken);
+        globalHistory = ((globalHistory << 1) | (taken ? 1u : 0u)) & historyMask();
+    }
+
+    // Alvo na BTB para o próximo encontro (JR também: usado quando o RAS está vazio)
+    if (taken && !btb.empty()) {
+        BTBEntry &e = btb[pc % btb.size()];
+        e.valid = true;
+        e.pc = pc;
+        e.target = target;
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef BRANCH_PREDICTOR_HPP
+#define BRANCH_PREDICTOR_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Direção dos desvios condicionais
+enum class BranchPredictorType {
+    STATIC_NOT_TAKEN,  // sempre segue em frente (comportamento sem preditor)
+    BIMODAL,           // contador de 2 bits por PC
+    GSHARE,            // contador de 2 bits por (PC xor histórico global)
+    TOURNAMENT         // bimodal x gshare, escolhido por PC (seletor de 2 bits)
+};
+
+// Classe do desvio (pré-decodificada na busca pelo opcode)
+enum class BranchKind {
+    NONE,
+    CONDITIONAL,  // BEQ / BNE
+    JUMP,         // J
+    CALL,         // JAL  (empilha o retorno no RAS)
+    RETURN        // JR   (desempilha do RAS)
+};
+
+struct BranchPredictorConfig {
+    BranchPredictorType type = BranchPredictorType::TOURNAMENT;
+    uint32_t tableBits = 10;     // 2^bits contadores por tabela
+    uint32_t historyBits = 10;   // bits do histórico global (gshare)
+    uint32_t btbEntries = 64;    // BTB mapeada diretamente (0 = sem BTB)
+    uint32_t rasDepth = 8;       // pilha de endereços de retorno (0 = sem RAS)
+};
+
+// Palpite feito na busca; volta ao preditor na resolução (EX)
+struct BranchPrediction {
+    bool taken = false;          // busca redirecionada para target
+    uint32_t target = 0;
+    uint32_t history = 0;        // histórico global no momento do palpite
+    bool btbHit = false;
+};
+
+// -------------------------------------------------------------
+//                     BRANCH PREDICTOR
+// -------------------------------------------------------------
+// Um por core (fica na Control_Unit). A busca só redireciona quando
+// conhece o alvo: pela BTB ou, em JR, pelo RAS. O estado sobrevive
+// às trocas de contexto — processos diferentes disputam as tabelas.
+class BranchPredictor {
+private:
+    BranchPredictorConfig config;
+
+    std::vector<uint8_t> bimodal;   // contadores saturados 0..3
+    std::vector<uint8_t> gshare;
+    std::vector<uint8_t> chooser;   // >= 2 → confia no gshare
+    uint32_t globalHistory = 0;
+
+    struct BTBEntry {
+        bool valid = false;
+        uint32_t pc = 0;
+        uint32_t target = 0;
+    };
+    std::vector<BTBEntry> btb;
+
+    std::vector<uint32_t> ras;      // circular: estouro sobrescreve o mais antigo
+    size_t rasTop = 0;
+    size_t rasCount = 0;
+
+    uint32_t tableMask() const { return (1u << config.tableBits) - 1; }
+    uint32_t historyMask() const { return (1u << config.historyBits) - 1; }
+    uint32_t gshareIndex(uint32_t pc, uint32_t history) const {
+        return (pc ^ history) & tableMask();
+    }
+    bool predictDirection(uint32_t pc, uint32_t history) const;
+    static void train(uint8_t &counter, bool taken);
+
+    const BTBEntry* lookupBTB(uint32_t pc) const;
+
+public:
+    explicit BranchPredictor(const BranchPredictorConfig &cfg = BranchPredictorConfig());
+
+    const BranchPredictorConfig& getConfig() const { return config; }
+
+    // Chamado na busca: nextPC da instrução em pc (pc + 1 se não redirecionar)
+    BranchPrediction predict(uint32_t pc, BranchKind kind);
+
+    // Chamado na resolução com o resultado real
+    void update(uint32_t pc, BranchKind kind, const BranchPrediction &pred,
+                bool taken, uint32_t target);
+
+    void pushReturn(uint32_t address);
+    bool popReturn(uint32_t &address);
+    size_t rasSize() const { return rasCount; }
+};
+
+#endif
@@ -73,6 +73,48 @@ static std::string toBinStr(uint32_t v, int width) {
     return s;
 }
 
+// Desvio resolvido no EX: as duas instruções buscadas depois dele
+// (IF e ID) são descartadas quando a busca seguiu o caminho errado
+static const uint64_t BRANCH_FLUSH_PENALTY = 2;
+
+// Índice do registrador ("01000" → 8); $zero não conta como destino
+static int regIndex(const std::string &bits) {
+    return bits.empty() ? -1 : static_cast<int>(binaryStringToUint(bits));
+}
+
+static void fillRegUsage(Instruction_Data &d) {
+    RegUsage &u = d.regs;
+    u = RegUsage();
+    const std::string &op = d.op;
+
+    if (op == "ADD" || op == "SUB" || op == "MULT" || op == "DIV") {
+        u.src[0] = regIndex(d.source_register);
+        u.src[1] = regIndex(d.target_register);
+        u.dest = regIndex(d.destination_register);
+    } else if (op == "ADDI" || op == "ADDIU" || op == "SLTI") {
+        u.src[0] = regIndex(d.source_register);
+        u.dest = regIndex(d.target_register);
+    } else if (op == "LUI" || op == "LI") {
+        u.dest = regIndex(d.target_register);
+    } else if (op == "LW" || op == "LA") {
+        u.dest = regIndex(d.target_register);
+        u.destAtMem = true;
+    } else if (op == "SW") {
+        u.storeSrc = regIndex(d.target_register);
+    } else if (op == "BEQ" || op == "BNE" || op == "BGT" || op == "BLT") {
+        u.src[0] = regIndex(d.source_register);
+        u.src[1] = regIndex(d.target_register);
+    } else if (op == "JR") {
+        u.src[0] = regIndex(d.source_register);
+    } else if (op == "JAL") {
+        u.dest = 31;
+    } else if (op == "PRINT") {
+        u.src[0] = regIndex(d.target_register);
+    }
+
+    if (u.dest == 0) u.dest = -1;
+}
+
 static inline void account_pipeline_cycle(PCB &p) { p.pipeline_cycles.fetch_add(1); }
 static inline void account_stage(PCB &p) { p.stage_invocations.fetch_add(1); }
 
@@ -118,6 +160,7 @@ string Control_Unit::Identificacao_instrucao(uint32_t instruction, hw::REGISTER_
             if (funct == 0x22) return "SUB";
             if (funct == 0x18) return "MULT";
             if (funct == 0x1A) return "DIV";
+            if (funct == 0x08) return "JR";
             // não reconhecido -> vazio
             return "";
         }
@@ -140,6 +183,17 @@ string Control_Unit::Identificacao_instrucao(uint32_t instruction, hw::REGISTER_
     }
 }
 
+BranchKind Control_Unit::Branch_Kind(uint32_t instruction) {
+    switch ((instruction >> 26) & 0x3Fu) {
+        case 0x00: return (instruction & 0x3Fu) == 0x08 ? BranchKind::RETURN : BranchKind::NONE;
+        case 0x02: return BranchKind::JUMP;
+        case 0x03: return BranchKind::CALL;
+        case 0x04:
+        case 0x05: return BranchKind::CONDITIONAL;
+        default:   return BranchKind::NONE;
+    }
+}
+
 void Control_Unit::Fetch(ControlContext &context) {
     account_stage(context.process);
 
@@ -148,8 +202,21 @@ void Control_Unit::Fetch(ControlContext &context) {
 
     uint32_t word_index = context.registers.pc.value;
 
-    // Lê instrução diretamente da memória (endereçada por palavra)
-    uint32_t instr = context.memManager.read(word_index, context.process);
+    // PC da busca no slot já aqui: mesmo uma busca que encerra o programa
+    // (END ou fora da partição) fica com o endereço certo no perfil
+    bool hasSlot = context.counter >= 0 && static_cast<size_t>(context.counter) < data.size();
+    if (hasSlot) data[context.counter].pc = word_index;
+
+    // Lê instrução pelo endereço lógico do processo (endereçado por palavra)
+    uint32_t instr;
+    try {
+        instr = context.memManager.readLogical(word_index, context.process, true);
+    } catch (const std::exception &e) {
+        std::cout << "[FETCH] PC=" << word_index << " inválido (" << e.what()
+                  << ") pid=" << context.process.pid << "\n";
+        context.endProgram = true;
+        return;
+    }
     context.registers.ir.write(instr);
 
     // TRACE FETCH
@@ -164,8 +231,22 @@ void Control_Unit::Fetch(ControlContext &context) {
         return;
     }
 
-    // PC ← PC + 1 (próxima WORD)
-    context.registers.pc.write(context.registers.pc.value + 1);
+    // PC ← PC + 1 (próxima WORD), ou o alvo previsto para o desvio
+    BranchKind kind = Branch_Kind(instr);
+    BranchPrediction pred = predictor.predict(word_index, kind);
+
+    if (hasSlot) {
+        Instruction_Data &slot = data[context.counter];
+        slot.branchKind = kind;
+        slot.prediction = pred;
+    }
+
+    if (pred.taken) {
+        std::cout << "[FETCH] desvio previsto tomado → PC=" << pred.target << "\n";
+        context.registers.pc.write(pred.target);
+    } else {
+        context.registers.pc.write(word_index + 1);
+    }
 }
 
 void Control_Unit::Decode(hw::REGISTER_BANK &registers, Instruction_Data &data) {
@@ -191,7 +272,9 @@ void Control_Unit::Decode(hw::REGISTER_BANK &registers, Instruction_Data &data)
         uint16_t imm16 = static_cast<uint16_t>(instruction & 0xFFFFu);
         data.immediate = signExtend16(imm16);
 
-    } else if (data.op == "J") {
+    } else if (data.op == "JR") {
+        data.source_register = Get_source_Register(instruction);
+    } else if (data.op == "J" || data.op == "JAL") {
         uint32_t instr26 = instruction & 0x03FFFFFFu;
         data.addressRAMResult = std::bitset<26>(instr26).to_string();
         data.immediate = static_cast<int32_t>(instr26);
@@ -210,6 +293,8 @@ void Control_Unit::Decode(hw::REGISTER_BANK &registers, Instruction_Data &data)
         }
     }
 
+    fillRegUsage(data);
+
     // === TRACE DECODE ===
     std::cout << "[DECODE] RAW=0x" << std::hex << data.rawInstruction << std::dec
               << " OP=" << (data.op.empty() ? "<UNKNOWN>" : data.op) << "\n";
@@ -345,63 +430,118 @@ void Control_Unit::Execute_Operation(Instruction_Data &data, ControlContext &con
     }
 }
 
-void Control_Unit::Execute_Loop_Operation( hw::REGISTER_BANK &registers, Instruction_Data &data,
-    int &counter, int &counterForEnd, bool &programEnd, MemoryManager &memManager,PCB &process)
+// Direção e alvo de um desvio com os valores de `registers` (sem efeitos)
+void Control_Unit::Resolve_Branch(hw::REGISTER_BANK &registers, const Instruction_Data &data,
+                                  bool &jump, uint32_t &addr)
 {
     string name_rs = this->map.getRegisterName(binaryStringToUint(data.source_register));
-    string name_rt = this->map.getRegisterName(binaryStringToUint(data.target_register));
 
-    ALU alu;
-    alu.A = registers.readRegister(name_rs);
-    alu.B = registers.readRegister(name_rt);
+    jump = false;
+    addr = 0;
+
+    if (data.op == "J" || data.op == "JAL") {
+        // Alvo absoluto (índice de palavra)
+        jump = true;
+        addr = binaryStringToUint(data.addressRAMResult);
+    } else if (data.op == "JR") {
+        jump = true;
+        addr = static_cast<uint32_t>(registers.readRegister(name_rs));
+    } else {
+        string name_rt = this->map.getRegisterName(binaryStringToUint(data.target_register));
 
+        ALU alu;
+        alu.A = registers.readRegister(name_rs);
+        alu.B = registers.readRegister(name_rt);
+
+        if (data.op == "BEQ") { alu.op = BEQ; alu.calculate(); jump = (alu.result == 1); }
+        else if (data.op == "BNE") { alu.op = BNE; alu.calculate(); jump = (alu.result == 1); }
+        else if (data.op == "BLT") { alu.op = BLT; alu.calculate(); jump = (alu.result == 1); }
+        else if (data.op == "BGT") { alu.op = BGT; alu.calculate(); jump = (alu.result == 1); }
+
+        // Offset em WORDS relativo ao PC visto no EX, que na busca
+        // sequencial já avançou duas palavras além do branch
+        addr = static_cast<uint32_t>(data.pc + 2 + data.immediate);
+    }
+}
+
+void Control_Unit::Execute_Loop_Operation( hw::REGISTER_BANK &registers, Instruction_Data &data,
+    int &counter, int &counterForEnd, bool &programEnd, MemoryManager &memManager,PCB &process)
+{
     bool jump = false;
+    uint32_t addr = 0;
+    Resolve_Branch(registers, data, jump, addr);
 
-    if (data.op == "BEQ") { alu.op = BEQ; alu.calculate(); jump = (alu.result == 1); }
-    else if (data.op == "BNE") { alu.op = BNE; alu.calculate(); jump = (alu.result == 1); }
-    else if (data.op == "BLT") { alu.op = BLT; alu.calculate(); jump = (alu.result == 1); }
-    else if (data.op == "BGT") { alu.op = BGT; alu.calculate(); jump = (alu.result == 1); }
-    else if (data.op == "J") { jump = true; }
+    if (data.op == "JAL") registers.writeRegister("ra", static_cast<int>(data.pc + 1));
 
-    if (jump) {
-        uint32_t addr = 0;
+    // Confere o palpite feito na busca e treina o preditor
+    uint32_t next = jump ? addr : data.pc + 1;
+    uint32_t predictedNext = data.prediction.taken ? data.prediction.target : data.pc + 1;
 
-        if (data.op == "J")
-        {
-            // Antes: addr = instr26 << 2;
-            // Agora: addr = índice de palavra diretamente
-            addr = binaryStringToUint(data.addressRAMResult);
-        }
-        else
-        {
-            // Branch offset já está em WORDS
-            // Antes: offset em bytes -> imm * 4
-            // Agora: offset é word offset
-            int32_t word_offset = data.immediate;
-
-            // PC já está em word addressing
-            addr = static_cast<uint32_t>(registers.pc.read() + word_offset);
-        }
+    predictor.update(data.pc, data.branchKind, data.prediction, jump, addr);
+    process.branches.fetch_add(1);
+
+    if (next == predictedNext) {
+        if (jump)
+            std::cout << "[BRANCH] OP=" << data.op << " taken (previsto), PC=" << addr << "\n";
+        return;
+    }
 
-        // LOG DO BRANCH
-        std::cout << "[BRANCH] OP=" << data.op << " taken, new PC=" << addr << "\n";
+    process.branch_mispredictions.fetch_add(1);
+    process.branch_flush_cycles.fetch_add(BRANCH_FLUSH_PENALTY);
 
-        // Atualiza PC (word-based)
-        registers.pc.write(addr);
+    // LOG DO BRANCH
+    std::cout << "[BRANCH] OP=" << data.op << (jump ? " taken" : " not taken")
+              << " (flush), new PC=" << next << "\n";
 
-        // Carrega nova instrução (PC agora é word index)
-        registers.ir.write(memManager.read(registers.pc.read(), process));
+    // Atualiza PC (word-based)
+    registers.pc.write(next);
 
-        counter = 0;
-        counterForEnd = 5;
-        programEnd = false;
+    // Carrega nova instrução (PC agora é word index)
+    try {
+        registers.ir.write(memManager.readLogical(registers.pc.read(), process, true));
+    } catch (const std::exception &e) {
+        std::cout << "[BRANCH] PC=" << next << " inválido (" << e.what() << ")\n";
+        programEnd = true;
+        return;
     }
+
+    counter = 0;
+    counterForEnd = 5;
+    programEnd = false;
 }
 
 
 
 
 
+// --------------------------------------------------
+// HAZARDS — chamado antes do EX. O MEM guarda quem saiu do EX no
+// ciclo anterior e o WB quem saiu do MEM; com bolha, o Core não
+// executa EX/ID/IF neste ciclo e empurra as instruções novas.
+// --------------------------------------------------
+bool Control_Unit::Hazard_Stall(ControlContext &context) {
+    int c = context.counter;
+    const RegUsage* mem = c >= 3 ? &data[c - 3].regs : nullptr;
+    const RegUsage* wb  = c >= 4 ? &data[c - 4].regs : nullptr;
+
+    HazardResult r = hazards.check(data[c - 2].regs, mem, wb);
+
+    if (r.stall) {
+        if (r.cause == HazardCause::LOAD_USE)
+            context.process.stall_load_use_cycles.fetch_add(1);
+        else
+            context.process.stall_raw_cycles.fetch_add(1);
+
+        std::cout << "[HAZARD] " << (r.cause == HazardCause::LOAD_USE ? "load-use" : "RAW")
+                  << " em " << data[c - 2].op << " (PC=" << data[c - 2].pc << "): bolha\n";
+        return true;
+    }
+
+    context.process.forwards_ex_mem.fetch_add(r.forwardsExMem);
+    context.process.forwards_mem_wb.fetch_add(r.forwardsMemWb);
+    return false;
+}
+
 void Control_Unit::Execute(Instruction_Data &data, ControlContext &context) {
     account_stage(context.process);
 
@@ -414,7 +554,7 @@ void Control_Unit::Execute(Instruction_Data &data, ControlContext &context) {
     // R-type
     if (data.op == "ADD" || data.op == "SUB" || data.op == "MULT" || data.op == "DIV") {
         Execute_Aritmetic_Operation(context.registers, data);
-    } else if (data.op == "BEQ" || data.op == "J" || data.op == "BNE" || data.op == "BGT" || data.op == "BGTI" || data.op == "BLT" || data.op == "BLTI") {
+    } else if (data.op == "BEQ" || data.op == "J" || data.op == "JAL" || data.op == "JR" || data.op == "BNE" || data.op == "BGT" || data.op == "BGTI" || data.op == "BLT" || data.op == "BLTI") {
         Execute_Loop_Operation(context.registers, data, context.counter, context.counterForEnd, context.endProgram, context.memManager, context.process);
     } else if (data.op == "PRINT") {
         Execute_Operation(data, context);
@@ -429,7 +569,13 @@ void Control_Unit::Memory_Acess(Instruction_Data &data, ControlContext &context)
         uint32_t addr = binaryStringToUint(data.addressRAMResult);
         // MemoryManager expects word index -> convert bytes -> words
         uint32_t word_index = addr / 4;
-        int value = context.memManager.read(word_index, context.process);
+        int value;
+        try {
+            value = context.memManager.readLogical(word_index, context.process);
+        } catch (const std::exception &e) {
+            std::cout << "[MEMORY] LW addr=" << addr << " inválido (" << e.what() << ")\n";
+            return;
+        }
         context.registers.writeRegister(name_rt, value);
 
         std::cout << "[MEMORY] LW addr=" << addr << " value=" << value
@@ -443,7 +589,13 @@ void Control_Unit::Memory_Acess(Instruction_Data &data, ControlContext &context)
     } else if (data.op == "PRINT" && data.target_register.empty()) {
         uint32_t addr = binaryStringToUint(data.addressRAMResult);
         uint32_t word_index = addr / 4;
-        int value = context.memManager.read(word_index, context.process);
+        int value;
+        try {
+            value = context.memManager.readLogical(word_index, context.process);
+        } catch (const std::exception &e) {
+            std::cout << "[PRINT-REQ] addr=" << addr << " inválido (" << e.what() << ")\n";
+            return;
+        }
         auto req = std::make_unique<IORequest>();
         req->msg = std::to_string(value);
         req->process = &context.process;
@@ -467,7 +619,12 @@ void Control_Unit::Write_Back(Instruction_Data &data, ControlContext &context) {
         uint32_t word_index = addr / 4;
         string name_rt = this->map.getRegisterName(binaryStringToUint(data.target_register));
         int value = context.registers.readRegister(name_rt);
-        context.memManager.write(word_index, value, context.process);
+        try {
+            context.memManager.writeLogical(word_index, value, context.process);
+        } catch (const std::exception &e) {
+            std::cout << "[WRITE-BACK] SW addr=" << addr << " inválido (" << e.what() << ")\n";
+            return;
+        }
 
         std::cout << "[WRITE-BACK] SW addr=" << addr << " value=" << value
                   << " from reg " << name_rt << "\n";
@@ -13,6 +13,8 @@
 #include "../IO/IOManager.hpp"
 #include "../cpu/ULA.hpp"
 #include "HASH_REGISTER.hpp"  // include correto conforme seu repositório
+#include "BranchPredictor.hpp"
+#include "HazardUnit.hpp"
 
 // =========================================================
 //   Instruction_Data — estrutura usada em CONTROL_UNIT.cpp
@@ -32,6 +34,14 @@ struct Instruction_Data {
 
     // immediate já sign-extended (em 32 bits), usado nas operações I-type
     int32_t immediate = 0;
+
+    // Preenchidos na busca: PC da instrução e palpite do preditor
+    uint32_t pc = 0;
+    BranchKind branchKind = BranchKind::NONE;
+    BranchPrediction prediction;
+
+    // Preenchido no Decode: dependências vistas pela unidade de hazards
+    RegUsage regs;
 };
 
 
@@ -115,6 +125,16 @@ public:
                                 int &counter, int &counterForEnd, bool &programEnd,
                                 MemoryManager &memManager, PCB &process);
 
+    // direção/alvo de um desvio (usado também pelo backend fora de ordem)
+    void Resolve_Branch(hw::REGISTER_BANK &registers, const Instruction_Data &data,
+                        bool &jump, uint32_t &addr);
+
+    // pré-decodificação usada pela busca (só o opcode/funct)
+    static BranchKind Branch_Kind(uint32_t instruction);
+
+    // Unidade de hazards: true = a instrução do EX espera (bolha neste ciclo)
+    bool Hazard_Stall(ControlContext &context);
+
     // Nota: "Memory_Acess" mantém o nome em português usado no .cpp (coerência)
     void Memory_Acess(Instruction_Data &data, ControlContext &context);
     void Write_Back(Instruction_Data &data, ControlContext &context);
@@ -137,6 +157,12 @@ public:
 
     // buffer do pipeline (cada entrada contém a instrução decodificada para cada estágio)
     std::vector<Instruction_Data> data;
+
+    // preditor de desvios consultado no Fetch e treinado no Execute
+    BranchPredictor predictor;
+
+    // detecção de RAW / load-use entre as entradas de `data` em voo
+    HazardUnit hazards;
 };
 
 #endif // CONTROL_UNIT_HPP
@@ -0,0 +1,52 @@
+#include "HazardUnit.hpp"
+
+HazardResult HazardUnit::check(const RegUsage &ex, const RegUsage* mem,
+                               const RegUsage* wb) const {
+    HazardResult r;
+
+    auto consume = [&](int reg, bool neededAtEx) {
+        if (reg < 0) return;
+
+        // O produtor mais novo vence (MEM antes de WB)
+        if (mem && mem->dest == reg) {
+            if (!forwarding) {
+                r.stall = true;
+                r.cause = HazardCause::RAW;
+            } else if (mem->destAtMem && neededAtEx) {
+                r.stall = true;
+                if (r.cause == HazardCause::NONE) r.cause = HazardCause::LOAD_USE;
+            } else if (mem->destAtMem) {
+                r.forwardsMemWb++;   // SW: o dado do LW chega pelo MEM/WB
+            } else {
+                r.forwardsExMem++;
+            }
+            return;
+        }
+
+        if (wb && wb->dest == reg) {
+            if (!forwarding) {
+                r.stall = true;
+                r.cause = HazardCause::RAW;
+            } else {
+                r.forwardsMemWb++;
+            }
+        }
+    };
+
+    consume(ex.src[0], true);
+    consume(ex.src[1], true);
+    consume(ex.storeSrc, false);
+
+    if (r.stall) {
+        r.forwardsExMem = 0;
+        r.forwardsMemWb = 0;
+    }
+    return r;
+}
+
+bool HazardUnit::dependsOn(const RegUsage &later, const RegUsage &earlier) {
+    if (earlier.dest < 0) return false;
+    return later.src[0] == earlier.dest ||
+           later.src[1] == earlier.dest ||
+           later.storeSrc == earlier.dest;
+}
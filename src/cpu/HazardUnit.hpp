@@ -0,0 +1,51 @@
+#ifndef HAZARD_UNIT_HPP
+#define HAZARD_UNIT_HPP
+
+#include <cstdint>
+
+// Registradores lidos/escritos por uma instrução (-1 = nenhum).
+// Preenchido no Decode a partir dos campos rs/rt/rd.
+struct RegUsage {
+    int src[2] = {-1, -1};   // lidos no EX (ALU, desvios, PRINT)
+    int storeSrc = -1;       // SW: dado lido só no MEM/WB
+    int dest = -1;           // escrito (nunca $zero)
+    bool destAtMem = false;  // LW: o valor só existe depois do MEM
+};
+
+enum class HazardCause {
+    NONE,
+    LOAD_USE,   // LW seguido de uso no EX: nem o encaminhamento resolve
+    RAW         // sem encaminhamento: espera o produtor sair do WB
+};
+
+struct HazardResult {
+    bool stall = false;
+    HazardCause cause = HazardCause::NONE;
+    uint32_t forwardsExMem = 0;   // operandos vindos do latch EX/MEM
+    uint32_t forwardsMemWb = 0;   // operandos vindos do latch MEM/WB
+};
+
+// -------------------------------------------------------------
+//                       HAZARD UNIT
+// -------------------------------------------------------------
+// Confere a instrução que vai entrar no EX contra as que estão no
+// MEM (saiu do EX no ciclo anterior) e no WB. Com encaminhamento só
+// o load-use para o pipeline (1 bolha); sem ele, qualquer RAW espera
+// o produtor terminar o WB (2 bolhas a distância 1, 1 a distância 2).
+class HazardUnit {
+private:
+    bool forwarding = true;
+
+public:
+    void setForwarding(bool on) { forwarding = on; }
+    bool getForwarding() const { return forwarding; }
+
+    // mem/wb: instruções nesses estágios (nullptr = vazio)
+    HazardResult check(const RegUsage &ex, const RegUsage* mem, const RegUsage* wb) const;
+
+    // Despacho múltiplo: `later` lê algo que `earlier` escreve? (mesmo
+    // grupo de despacho não tem encaminhamento entre si)
+    static bool dependsOn(const RegUsage &later, const RegUsage &earlier);
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef INSTRUCTION_CLASS_HPP
+#define INSTRUCTION_CLASS_HPP
+
+#include <cstddef>
+#include <string>
+
+// -------------------------------------------------------------
+//                 CLASSES DE INSTRUÇÃO
+// -------------------------------------------------------------
+// Agrupa os mnemônicos da Control_Unit pelo recurso que usam: a energia
+// por instrução e o mix de instruções são contados por classe.
+enum class InstrClass {
+    ALU,        // ADD/SUB/ADDI/LI/LA/LUI/SLTI...
+    MULDIV,     // MULT/DIV
+    BRANCH,     // desvios condicionais, J/JAL/JR
+    LOAD,       // LW
+    STORE,      // SW
+    IO,         // PRINT
+    COUNT
+};
+
+constexpr size_t INSTR_CLASS_COUNT = static_cast<size_t>(InstrClass::COUNT);
+
+inline InstrClass classifyOp(const std::string &op) {
+    if (op == "LW") return InstrClass::LOAD;
+    if (op == "SW") return InstrClass::STORE;
+    if (op == "PRINT") return InstrClass::IO;
+    if (op == "MULT" || op == "DIV") return InstrClass::MULDIV;
+    if (op == "J" || op == "JAL" || op == "JR" || (!op.empty() && op[0] == 'B'))
+        return InstrClass::BRANCH;
+    return InstrClass::ALU;
+}
+
+inline const char* instrClassName(InstrClass c) {
+    switch (c) {
+        case InstrClass::ALU:    return "alu";
+        case InstrClass::MULDIV: return "muldiv";
+        case InstrClass::BRANCH: return "branch";
+        case InstrClass::LOAD:   return "load";
+        case InstrClass::STORE:  return "store";
+        case InstrClass::IO:     return "io";
+        default:                 return "?";
+    }
+}
+
+#endif
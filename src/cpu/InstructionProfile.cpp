@@ -0,0 +1,84 @@
+#include "InstructionProfile.hpp"
+#include <algorithm>
+
+// --------------------------------------------------
+// enable / grow
+// --------------------------------------------------
+void InstructionProfile::enable(uint32_t base_, uint32_t words) {
+    on = true;
+    base = base_;
+    fixed = words > 0;
+    grow(words);
+}
+
+void InstructionProfile::grow(size_t words) {
+    // Sem tamanho conhecido, dobra para não realocar a cada PC novo
+    if (!fixed && words > executions.size())
+        words = std::max(words, executions.size() * 2);
+
+    executions.resize(words, 0);
+    stalls.resize(words, 0);
+    memory.resize(words, 0);
+    classes.resize(words, 0);
+    flags.resize(words, 0);
+}
+
+// --------------------------------------------------
+// Blocos básicos: PCs executados e contíguos, cortados nos alvos de
+// desvio (BLOCK_START) e depois dos desvios (BLOCK_END)
+// --------------------------------------------------
+std::vector<InstructionProfile::Block> InstructionProfile::hotBlocks() const {
+    std::vector<Block> blocks;
+    Block cur;
+    bool open = false;
+
+    for (size_t i = 0; i < executions.size(); i++) {
+        if (executions[i] == 0 || (open && (flags[i] & BLOCK_START))) {
+            if (open) blocks.push_back(cur);
+            open = false;
+            if (executions[i] == 0) continue;
+        }
+
+        if (!open) {
+            cur = Block();
+            cur.start = base + static_cast<uint32_t>(i);
+            cur.executions = executions[i];
+            open = true;
+        }
+        cur.end = base + static_cast<uint32_t>(i);
+        cur.instructions += executions[i];
+        cur.stallCycles += stalls[i];
+        cur.memCycles += memory[i];
+
+        if (flags[i] & BLOCK_END) {
+            blocks.push_back(cur);
+            open = false;
+        }
+    }
+    if (open) blocks.push_back(cur);
+
+    std::stable_sort(blocks.begin(), blocks.end(), [](const Block &a, const Block &b) {
+        return a.cycles() > b.cycles();
+    });
+    return blocks;
+}
+
+std::vector<InstructionProfile::PcCount> InstructionProfile::hotPcs() const {
+    std::vector<PcCount> pcs;
+    for (size_t i = 0; i < executions.size(); i++) {
+        if (executions[i] == 0) continue;
+
+        PcCount c;
+        c.pc = base + static_cast<uint32_t>(i);
+        c.cls = static_cast<InstrClass>(classes[i]);
+        c.executions = executions[i];
+        c.stallCycles = stalls[i];
+        c.memCycles = memory[i];
+        pcs.push_back(c);
+    }
+
+    std::stable_sort(pcs.begin(), pcs.end(), [](const PcCount &a, const PcCount &b) {
+        return a.cycles() > b.cycles();
+    });
+    return pcs;
+}
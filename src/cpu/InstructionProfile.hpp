@@ -0,0 +1,117 @@
+#ifndef INSTRUCTION_PROFILE_HPP
+#define INSTRUCTION_PROFILE_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "InstructionClass.hpp"
+
+// -------------------------------------------------------------
+//          PERFIL DE INSTRUÇÕES (mix e hotspots por PC)
+// -------------------------------------------------------------
+// Contadores de um processo em vetores indexados pelo offset do PC no
+// código (pc - base), sem mapas no caminho quente:
+// - execuções de cada PC e a classe da instrução;
+// - ciclos de bolha (hazard) com a instrução parada no EX;
+// - ciclos de memória cobrados na busca e no MEM da instrução.
+// Os blocos básicos são reconstruídos dos desvios observados: um PC
+// fora de sequência é alvo de desvio (início de bloco) e a instrução
+// anterior a ele, assim como todo desvio, fecha um bloco.
+class InstructionProfile {
+public:
+    struct Block {
+        uint32_t start = 0;          // PCs lógicos [start, end]
+        uint32_t end = 0;
+        uint64_t executions = 0;     // vezes que o bloco foi executado
+        uint64_t instructions = 0;
+        uint64_t stallCycles = 0;
+        uint64_t memCycles = 0;
+
+        uint64_t cycles() const { return instructions + stallCycles + memCycles; }
+    };
+
+    struct PcCount {
+        uint32_t pc = 0;
+        InstrClass cls = InstrClass::ALU;
+        uint64_t executions = 0;
+        uint64_t stallCycles = 0;
+        uint64_t memCycles = 0;
+
+        uint64_t cycles() const { return executions + stallCycles + memCycles; }
+    };
+
+    // Liga o perfil para o código em [base, base + words); words = 0
+    // cresce sob demanda
+    void enable(uint32_t base, uint32_t words = 0);
+    bool enabled() const { return on; }
+
+    // Caminho quente: uma instrução que passou pelo EX (ou fez commit)
+    void record(uint32_t pc, InstrClass cls) {
+        mix[static_cast<size_t>(cls)]++;
+        uint32_t off;
+        if (!slot(pc, off)) { outside++; return; }
+
+        executions[off]++;
+        classes[off] = static_cast<uint8_t>(cls);
+        if (cls == InstrClass::BRANCH) flags[off] |= BLOCK_END;
+
+        if (hasLast && pc != lastPc + 1) {
+            flags[off] |= BLOCK_START;
+            if (lastPc >= base) flags[lastPc - base] |= BLOCK_END;
+        }
+        lastPc = pc;
+        hasLast = true;
+    }
+
+    void addStall(uint32_t pc, uint64_t cycles = 1) {
+        uint32_t off;
+        if (cycles && slot(pc, off)) stalls[off] += cycles;
+    }
+
+    void addMemory(uint32_t pc, uint64_t cycles) {
+        uint32_t off;
+        if (cycles && slot(pc, off)) memory[off] += cycles;
+    }
+
+    const std::array<uint64_t, INSTR_CLASS_COUNT>& getMix() const { return mix; }
+    uint64_t getOutside() const { return outside; }
+
+    // Blocos e PCs executados, do mais caro para o mais barato (ciclos)
+    std::vector<Block> hotBlocks() const;
+    std::vector<PcCount> hotPcs() const;
+
+private:
+    enum : uint8_t { BLOCK_START = 1, BLOCK_END = 2 };
+
+    // Offset do PC nos vetores (false = fora do código)
+    bool slot(uint32_t pc, uint32_t &off) {
+        if (pc < base) return false;
+        off = pc - base;
+        if (off >= executions.size()) {
+            if (fixed) return false;
+            grow(off + 1);
+        }
+        return true;
+    }
+
+    void grow(size_t words);
+
+    bool on = false;
+    bool fixed = false;        // tamanho do código conhecido no enable
+    uint32_t base = 0;
+
+    std::vector<uint64_t> executions;
+    std::vector<uint64_t> stalls;
+    std::vector<uint64_t> memory;
+    std::vector<uint8_t> classes;
+    std::vector<uint8_t> flags;
+
+    std::array<uint64_t, INSTR_CLASS_COUNT> mix{};
+    uint64_t outside = 0;      // PCs fora do código (não entram nos vetores)
+
+    uint32_t lastPc = 0;
+    bool hasLast = false;
+};
+
+#endif
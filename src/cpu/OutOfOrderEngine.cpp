@@ -0,0 +1,345 @@
+#include "OutOfOrderEngine.hpp"
+
+#include <iostream>
+
+// --------------------------------------------------
+// Construtor / reset
+// --------------------------------------------------
+OutOfOrderEngine::OutOfOrderEngine(const OutOfOrderConfig &cfg)
+    : config(cfg)
+{
+    if (config.robEntries == 0) config.robEntries = 1;
+    if (config.rsEntries == 0) config.rsEntries = 1;
+    if (config.lsqEntries == 0) config.lsqEntries = 1;
+    reset();
+}
+
+void OutOfOrderEngine::reset() {
+    rob.clear();
+    rat.fill(-1);
+    serialPending = false;
+}
+
+// --------------------------------------------------
+// Helpers
+// --------------------------------------------------
+OutOfOrderEngine::Entry* OutOfOrderEngine::find(int64_t seq) {
+    if (seq < 0 || rob.empty()) return nullptr;
+    uint64_t first = rob.front().seq;
+    uint64_t s = static_cast<uint64_t>(seq);
+    if (s < first || s - first >= rob.size()) return nullptr;
+    return &rob[s - first];
+}
+
+bool OutOfOrderEngine::operandsReady(const Entry &e) const {
+    return e.srcTag[0] < 0 && e.srcTag[1] < 0;
+}
+
+// Resultado pronto: acorda quem esperava por esta entrada
+void OutOfOrderEngine::broadcast(const Entry &producer) {
+    int64_t tag = static_cast<int64_t>(producer.seq);
+    for (Entry &e : rob) {
+        for (int i = 0; i < 2; i++) {
+            if (e.srcTag[i] == tag) {
+                e.srcTag[i] = -1;
+                e.srcVal[i] = producer.value;
+            }
+        }
+        if (e.storeTag == tag) {
+            e.storeTag = -1;
+            e.storeVal = producer.value;
+        }
+    }
+}
+
+// Desvio mal previsto: descarta tudo depois de `seq` e refaz a renomeação
+void OutOfOrderEngine::squashAfter(uint64_t seq) {
+    while (!rob.empty() && rob.back().seq > seq) {
+        if (rob.back().serial) serialPending = false;
+        rob.pop_back();
+        stats.squashed++;
+    }
+
+    rat.fill(-1);
+    for (const Entry &e : rob)
+        if (e.inst.regs.dest >= 0)
+            rat[e.inst.regs.dest] = static_cast<int64_t>(e.seq);
+}
+
+// --------------------------------------------------
+// CICLO
+// --------------------------------------------------
+// Ordem inversa do fluxo, como no pipeline em ordem: o que termina
+// neste ciclo já pode fazer commit, e o que é despachado agora só
+// sai para as unidades no próximo.
+uint32_t OutOfOrderEngine::cycle(ControlContext &ctx, Control_Unit &uc,
+                                 int width, int alus, int memPorts, bool fetch) {
+    uint64_t before = stats.committed;
+
+    complete(ctx, uc);
+    commit(ctx, uc, width);
+    issue(ctx, uc, alus, memPorts);
+    if (fetch) dispatch(ctx, uc, width);
+
+    stats.robOccupancy += rob.size();
+    stats.cycles++;
+    now++;
+
+    return static_cast<uint32_t>(stats.committed - before);
+}
+
+// --------------------------------------------------
+// CONCLUSÃO (+ resolução de desvios)
+// --------------------------------------------------
+void OutOfOrderEngine::complete(ControlContext &ctx, Control_Unit &uc) {
+    for (size_t i = 0; i < rob.size(); i++) {
+        Entry &e = rob[i];
+        if (e.phase != Phase::EXECUTING || e.readyAt > now) continue;
+
+        e.phase = Phase::DONE;
+        broadcast(e);
+
+        if (e.inst.branchKind == BranchKind::NONE) continue;
+
+        const Instruction_Data &d = e.inst;
+        uint32_t next = e.jump ? e.target : d.pc + 1;
+        uint32_t predictedNext = d.prediction.taken ? d.prediction.target : d.pc + 1;
+
+        uc.predictor.update(d.pc, d.branchKind, d.prediction, e.jump, e.target);
+        ctx.process.branches.fetch_add(1);
+
+        if (next == predictedNext) continue;
+
+        ctx.process.branch_mispredictions.fetch_add(1);
+        std::cout << "[OOO] " << d.op << " em PC=" << d.pc
+                  << " mal previsto, descarta " << (rob.size() - i - 1)
+                  << " instruções, novo PC=" << next << "\n";
+
+        squashAfter(e.seq);
+        ctx.registers.pc.write(next);
+
+        // A busca voltou ao caminho certo: um END ou fim de quantum vistos
+        // no caminho errado não valem (o Core reavalia o quantum)
+        ctx.endProgram = false;
+        ctx.endExecution = false;
+        break;
+    }
+}
+
+// --------------------------------------------------
+// COMMIT EM ORDEM — único ponto que altera regBank e memória
+// --------------------------------------------------
+void OutOfOrderEngine::commit(ControlContext &ctx, Control_Unit &uc, int width) {
+    uint32_t n = 0;
+
+    while (n < static_cast<uint32_t>(width) && !rob.empty()) {
+        Entry &e = rob.front();
+
+        if (e.phase != Phase::DONE) {
+            if (e.isLoad && e.phase == Phase::EXECUTING)
+                stats.headMemStallCycles++;
+            break;
+        }
+
+        int dest = e.inst.regs.dest;
+        if (e.isStore) {
+            try {
+                ctx.memManager.writeLogical(e.wordAddr, e.storeVal, ctx.process);
+                std::cout << "[OOO] commit SW addr=" << e.wordAddr * 4
+                          << " value=" << static_cast<int32_t>(e.storeVal) << "\n";
+            } catch (const std::exception &ex) {
+                std::cout << "[OOO] SW addr=" << e.wordAddr * 4 << " inválido (" << ex.what() << ")\n";
+            }
+        } else if (dest >= 0) {
+            ctx.registers.writeRegister(uc.map.getRegisterName(dest), e.value);
+        }
+
+        if (dest >= 0 && rat[dest] == static_cast<int64_t>(e.seq))
+            rat[dest] = -1;
+
+        if (!e.inst.op.empty()) {
+            InstrClass cls = classifyOp(e.inst.op);
+            stats.committed++;
+            stats.committedByClass[static_cast<size_t>(cls)]++;
+            if (ctx.process.profile.enabled()) ctx.process.profile.record(e.inst.pc, cls);
+        }
+        rob.pop_front();
+        n++;
+    }
+}
+
+// --------------------------------------------------
+// DESPACHO PARA AS UNIDADES (fora de ordem, mais antigo primeiro)
+// --------------------------------------------------
+void OutOfOrderEngine::issue(ControlContext &ctx, Control_Unit &uc, int alus, int memPorts) {
+    int aluUsed = 0;
+    int memUsed = 0;
+
+    for (size_t i = 0; i < rob.size(); i++) {
+        Entry &e = rob[i];
+        if (e.phase != Phase::WAITING) continue;
+
+        // PRINT: só como instrução mais antiga, pela Control_Unit. Com o
+        // printLock o processo bloqueia aqui e o Core sai do ciclo.
+        if (e.serial) {
+            if (i != 0) continue;
+            uc.Execute(e.inst, ctx);
+            uc.Memory_Acess(e.inst, ctx);
+            serialPending = false;
+            rob.pop_front();
+            stats.committed++;
+            stats.committedByClass[static_cast<size_t>(InstrClass::IO)]++;
+            if (ctx.process.profile.enabled()) ctx.process.profile.record(e.inst.pc, InstrClass::IO);
+            i--;
+            continue;
+        }
+
+        // SW: endereço é imediato; só espera o dado (a escrita é no commit)
+        if (e.isStore) {
+            if (e.storeTag < 0) {
+                e.phase = Phase::DONE;
+                e.readyAt = now;
+            }
+            continue;
+        }
+
+        if (!operandsReady(e)) continue;
+
+        if (e.isLoad) {
+            if (memUsed >= memPorts) continue;
+
+            // Store mais antigo para o mesmo endereço ainda no LSQ
+            const Entry* older = nullptr;
+            for (size_t j = 0; j < i; j++)
+                if (rob[j].isStore && rob[j].wordAddr == e.wordAddr)
+                    older = &rob[j];
+
+            if (older && older->storeTag >= 0) continue;   // dado ainda não existe
+
+            memUsed++;
+            if (older) {
+                e.value = older->storeVal;
+                e.readyAt = now + 1;
+                stats.storeForwards++;
+            } else {
+                execute(e, ctx, uc);
+            }
+            e.phase = Phase::EXECUTING;
+            continue;
+        }
+
+        if (aluUsed >= alus) continue;
+        aluUsed++;
+        execute(e, ctx, uc);
+        e.phase = Phase::EXECUTING;
+    }
+}
+
+// Unidade funcional: a ALU da Control_Unit sobre os operandos
+// renomeados (copiados para um banco de rascunho) ou o MemoryManager
+void OutOfOrderEngine::execute(Entry &e, ControlContext &ctx, Control_Unit &uc) {
+    Instruction_Data &d = e.inst;
+    e.readyAt = now + 1;
+
+    if (e.isLoad) {
+        uint64_t before = ctx.process.memory_cycles.load();
+        try {
+            e.value = ctx.memManager.readLogical(e.wordAddr, ctx.process);
+        } catch (const std::exception &ex) {
+            std::cout << "[OOO] LW addr=" << e.wordAddr * 4 << " inválido (" << ex.what() << ")\n";
+            e.value = 0;
+        }
+        uint64_t latency = ctx.process.memory_cycles.load() - before;
+        stats.loadLatency += latency;
+        if (latency > 1) e.readyAt = now + latency;
+
+        std::cout << "[OOO] LW addr=" << e.wordAddr * 4 << " value=" << static_cast<int32_t>(e.value)
+                  << " (" << (e.readyAt - now) << " ciclos)\n";
+        return;
+    }
+
+    for (int k = 0; k < 2; k++)
+        if (d.regs.src[k] >= 0)
+            scratch.writeRegister(uc.map.getRegisterName(d.regs.src[k]), e.srcVal[k]);
+
+    std::string dest = d.regs.dest >= 0 ? uc.map.getRegisterName(d.regs.dest) : "";
+
+    if (d.branchKind != BranchKind::NONE) {
+        uc.Resolve_Branch(scratch, d, e.jump, e.target);
+        if (d.op == "JAL") e.value = d.pc + 1;
+    } else if (d.op == "ADD" || d.op == "SUB" || d.op == "MULT" || d.op == "DIV") {
+        uc.Execute_Aritmetic_Operation(scratch, d);
+        e.value = scratch.readRegister(dest);
+    } else if (d.op == "ADDI" || d.op == "ADDIU" || d.op == "SLTI" || d.op == "LUI") {
+        uc.Execute_Immediate_Operation(scratch, d);
+        e.value = scratch.readRegister(dest);
+    } else if (d.op == "LI" || d.op == "LA") {
+        // Mesmo valor que o estágio MEM grava (imediato sem sinal)
+        e.value = d.rawInstruction & 0xFFFFu;
+    }
+}
+
+// --------------------------------------------------
+// BUSCA + DECODIFICAÇÃO + RENOMEAÇÃO
+// --------------------------------------------------
+void OutOfOrderEngine::dispatch(ControlContext &ctx, Control_Unit &uc, int width) {
+    for (int n = 0; n < width; n++) {
+        if (ctx.endExecution || ctx.endProgram || serialPending) return;
+
+        size_t rsUsed = 0, lsqUsed = 0;
+        for (const Entry &e : rob) {
+            if (e.isLoad || e.isStore) lsqUsed++;
+            else if (e.phase == Phase::WAITING) rsUsed++;
+        }
+        if (rob.size() >= config.robEntries) { stats.robFullCycles++; return; }
+        if (rsUsed >= config.rsEntries)      { stats.rsFullCycles++; return; }
+        if (lsqUsed >= config.lsqEntries)    { stats.lsqFullCycles++; return; }
+
+        // A Control_Unit busca para data[counter]; o backend usa só a posição 0
+        ctx.counter = 0;
+        if (uc.data.empty()) uc.data.resize(1);
+        uc.data[0] = Instruction_Data();
+        uc.Fetch(ctx);
+        if (ctx.endProgram) return;   // END (ou PC inválido)
+
+        Entry e;
+        e.inst = uc.data[0];
+        uc.Decode(ctx.registers, e.inst);
+        e.seq = nextSeq++;
+
+        // Renomeação dos operandos
+        auto rename = [&](int reg, int64_t &tag, uint32_t &val) {
+            if (reg < 0) return;
+            if (rat[reg] >= 0) {
+                Entry* p = find(rat[reg]);
+                if (p && p->phase == Phase::DONE) { val = p->value; return; }
+                if (p) { tag = rat[reg]; return; }
+            }
+            val = ctx.registers.readRegister(uc.map.getRegisterName(reg));
+        };
+        const RegUsage &u = e.inst.regs;
+        rename(u.src[0], e.srcTag[0], e.srcVal[0]);
+        rename(u.src[1], e.srcTag[1], e.srcVal[1]);
+        rename(u.storeSrc, e.storeTag, e.storeVal);
+
+        const std::string &op = e.inst.op;
+        e.isLoad = (op == "LW");
+        e.isStore = (op == "SW");
+        e.serial = (op == "PRINT");
+        if (e.isLoad || e.isStore)
+            e.wordAddr = (e.inst.rawInstruction & 0xFFFFu) / 4;
+        if (op.empty()) {
+            e.phase = Phase::DONE;   // nop
+            e.readyAt = now;
+        }
+        if (e.serial) serialPending = true;
+
+        if (u.dest >= 0) rat[u.dest] = static_cast<int64_t>(e.seq);
+
+        bool redirected = e.inst.prediction.taken;
+        rob.push_back(std::move(e));
+
+        // A busca segue o alvo previsto só no próximo ciclo
+        if (redirected) return;
+    }
+}
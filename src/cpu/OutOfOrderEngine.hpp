@@ -0,0 +1,118 @@
+#ifndef OUT_OF_ORDER_ENGINE_HPP
+#define OUT_OF_ORDER_ENGINE_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+
+#include "CONTROL_UNIT.hpp"
+#include "InstructionClass.hpp"
+#include "REGISTER_BANK.hpp"
+
+struct OutOfOrderConfig {
+    bool enabled = false;
+    size_t robEntries = 32;   // reorder buffer
+    size_t rsEntries = 16;    // estações de reserva (ALU/desvios)
+    size_t lsqEntries = 16;   // fila de loads/stores
+};
+
+// -------------------------------------------------------------
+//                 OUT-OF-ORDER ENGINE (Tomasulo + ROB)
+// -------------------------------------------------------------
+// Backend alternativo do Core. A busca e a decodificação são as da
+// Control_Unit (com o preditor); depois disso:
+// - renomeação: cada registrador aponta para a entrada do ROB que vai
+//   produzi-lo (ou para o banco, se não há produtor em voo);
+// - estações de reserva: a instrução espera os operandos e sai para a
+//   ALU assim que eles chegam, fora da ordem do programa;
+// - LSQ: loads leem a memória (pelo MemoryManager) quando não há store
+//   mais antigo pendente para o mesmo endereço — com o dado pronto, ele
+//   é encaminhado; a latência do load é o custo cobrado pelo
+//   MemoryManager (memWeights) neste acesso;
+// - commit em ordem: só aqui o PCB::regBank e a memória mudam, então o
+//   estado é preciso em preempção, bloqueio e desvio mal previsto.
+// PRINT é serializante: executa pela Control_Unit quando é o mais
+// antigo do ROB, como no pipeline em ordem.
+class OutOfOrderEngine {
+public:
+    struct Stats {
+        uint64_t committed = 0;
+        uint64_t squashed = 0;           // descartadas por desvio mal previsto
+        uint64_t robFullCycles = 0;      // despacho parado por falta de espaço
+        uint64_t rsFullCycles = 0;
+        uint64_t lsqFullCycles = 0;
+        uint64_t storeForwards = 0;      // load servido por store do LSQ
+        uint64_t loadLatency = 0;        // ciclos de memória somados dos loads
+        uint64_t headMemStallCycles = 0; // commit parado esperando um load
+        uint64_t robOccupancy = 0;       // soma por ciclo (média = / ciclos)
+        uint64_t cycles = 0;
+        std::array<uint64_t, INSTR_CLASS_COUNT> committedByClass{};
+    };
+
+    explicit OutOfOrderEngine(const OutOfOrderConfig &cfg = OutOfOrderConfig());
+
+    // Esvazia ROB/RS/LSQ e a tabela de renomeação (novo processo no core)
+    void reset();
+
+    // Um ciclo: conclusão, commit, despacho para as unidades e
+    // busca/renomeação. Devolve quantas instruções fizeram commit.
+    // fetch = false: o contexto SMT não ganhou a busca neste ciclo.
+    uint32_t cycle(ControlContext &ctx, Control_Unit &uc,
+                   int width, int alus, int memPorts, bool fetch = true);
+
+    bool empty() const { return rob.empty(); }
+    size_t occupancy() const { return rob.size(); }
+
+    const OutOfOrderConfig& getConfig() const { return config; }
+    const Stats& getStats() const { return stats; }
+
+private:
+    enum class Phase { WAITING, EXECUTING, DONE };
+
+    struct Entry {
+        Instruction_Data inst;
+        uint64_t seq = 0;
+        Phase phase = Phase::WAITING;
+
+        // Operandos: tag = seq do produtor em voo, -1 = valor pronto
+        int64_t srcTag[2] = {-1, -1};
+        uint32_t srcVal[2] = {0, 0};
+        int64_t storeTag = -1;
+        uint32_t storeVal = 0;
+
+        uint32_t value = 0;       // resultado (vai para o banco no commit)
+        uint64_t readyAt = 0;     // ciclo em que a unidade termina
+
+        bool isLoad = false;
+        bool isStore = false;
+        bool serial = false;      // PRINT
+        uint32_t wordAddr = 0;    // LW/SW
+
+        bool jump = false;        // desvio resolvido
+        uint32_t target = 0;
+    };
+
+    OutOfOrderConfig config;
+    std::deque<Entry> rob;
+    std::array<int64_t, 32> rat;  // registrador → seq do produtor (-1 = banco)
+    uint64_t nextSeq = 0;
+    uint64_t now = 0;
+    bool serialPending = false;   // PRINT no ROB: busca parada até o commit
+
+    hw::REGISTER_BANK scratch;    // operandos renomeados para a ALU
+    Stats stats;
+
+    Entry* find(int64_t seq);
+    bool operandsReady(const Entry &e) const;
+    void broadcast(const Entry &producer);
+
+    void complete(ControlContext &ctx, Control_Unit &uc);
+    void commit(ControlContext &ctx, Control_Unit &uc, int width);
+    void issue(ControlContext &ctx, Control_Unit &uc, int alus, int memPorts);
+    void dispatch(ControlContext &ctx, Control_Unit &uc, int width);
+
+    void execute(Entry &e, ControlContext &ctx, Control_Unit &uc);
+    void squashAfter(uint64_t seq);
+};
+
+#endif
@@ -11,7 +11,9 @@
 #include <vector>
 
 #include "memory/cache.hpp"
+#include "memory/Paging.hpp"
 #include "REGISTER_BANK.hpp" // necessidade de objeto completo dentro do PCB
+#include "InstructionProfile.hpp"
 
 // Estados possíveis do processo (compatível com CONTROL_UNIT)
 enum class State {
@@ -27,6 +29,15 @@ struct MemWeights {
     uint64_t secondary = 10; // custo por acesso à memória secundária
 };
 
+// Descritor de segmento: base/limite validados na alocação. A
+// tradução lógico → físico vira um teste de limite + soma, sem
+// consultar o vetor de partições a cada acesso.
+struct SegmentDescriptor {
+    uint32_t base = 0;
+    uint32_t limit = 0;     // tamanho do segmento (endereços válidos: [0, limit))
+    bool valid = false;
+};
+
 struct PCB {
     // Identificação
     int pid = 0;
@@ -47,6 +58,20 @@ struct PCB {
     int partition_id = -1;        // índice da partição alocada (ou -1)
     uint32_t partition_base = 0;  // endereço físico base da partição
     uint32_t partition_size = 0;  // tamanho em bytes da partição
+    SegmentDescriptor segment;    // cache da partição para tradução O(1)
+
+    // Código compartilhado (somente leitura) entre processos com o mesmo
+    // programa: endereços lógicos a partir de text_base caem no segmento
+    // do dono (MemoryManager::loadProgram)
+    int shared_text = -1;         // id do segmento compartilhado (-1 = código privado)
+    uint32_t text_base = 0;       // endereço lógico onde começa o código
+    SegmentDescriptor textSegment;// partições: base/limite físicos do código
+
+    // NUMA: nó onde a memória do processo foi posta (afinidade do escalonador)
+    int numa_home = -1;
+
+    // Paginação (MemoryMode::PAGING): página virtual → quadro físico
+    std::vector<PageTableEntry> pageTable;
 
     // Offsets dentro da partição (tudo em palavras/endereços conforme seu MemoryManager)
     uint32_t data_bytes = 0;      // tamanho do segmento DATA (em palavras)
@@ -69,6 +94,8 @@ struct PCB {
     std::atomic<uint64_t> mem_accesses_total{0};
     std::atomic<uint64_t> extra_cycles{0};
     std::atomic<uint64_t> cache_mem_accesses{0};
+    std::atomic<uint64_t> write_stall_cycles{0}; // escritas síncronas (buffer cheio / sem buffer)
+    std::atomic<uint64_t> bus_wait_cycles{0};    // fila no barramento/bancos + row misses
 
     // Instrumentação detalhada
     std::atomic<uint64_t> pipeline_cycles{0};
@@ -76,12 +103,58 @@ struct PCB {
     std::atomic<uint64_t> mem_reads{0};
     std::atomic<uint64_t> mem_writes{0};
 
+    // Desvios resolvidos no EX e os que esvaziaram o pipeline
+    std::atomic<uint64_t> branches{0};
+    std::atomic<uint64_t> branch_mispredictions{0};
+    std::atomic<uint64_t> branch_flush_cycles{0};
+
+    // Hazards de dados: bolhas por causa e operandos encaminhados
+    std::atomic<uint64_t> stall_load_use_cycles{0};
+    std::atomic<uint64_t> stall_raw_cycles{0};     // só sem encaminhamento
+    std::atomic<uint64_t> forwards_ex_mem{0};
+    std::atomic<uint64_t> forwards_mem_wb{0};
+
     // Contadores de cache
     std::atomic<uint64_t> cache_hits{0};
     std::atomic<uint64_t> cache_misses{0};
 
+    // Classificação dos misses (3C) e hits na victim cache
+    std::atomic<uint64_t> miss_compulsory{0};
+    std::atomic<uint64_t> miss_capacity{0};
+    std::atomic<uint64_t> miss_conflict{0};
+    std::atomic<uint64_t> victim_hits{0};
+
+    // Tradução de endereços (paginação)
+    std::atomic<uint64_t> tlb_hits{0};
+    std::atomic<uint64_t> tlb_misses{0};
+    std::atomic<uint64_t> page_faults{0};
+    std::atomic<uint64_t> page_fault_wait{0};    // ticks restantes bloqueado (swap-in)
+    std::atomic<uint64_t> page_fault_cycles{0};  // total gasto em swap-in/out
+
+    // NUMA: acessos à RAM do próprio nó do core ou de outro nó
+    std::atomic<uint64_t> numa_local_accesses{0};
+    std::atomic<uint64_t> numa_remote_accesses{0};
+
+    // Carga do programa (DMA, fora da execução)
+    std::atomic<uint64_t> load_cycles{0};
+
     // IO
     std::atomic<uint64_t> io_cycles{0};
+    std::atomic<uint64_t> io_blocks{0};   // vezes que bloqueou esperando I/O
+
+    // Troca de contexto (Core::configureContextSwitch)
+    std::atomic<uint64_t> context_switches{0};       // saídas do core antes do fim
+    std::atomic<uint64_t> context_switch_cycles{0};  // salvar/restaurar registradores
+    std::atomic<uint64_t> switch_drain_cycles{0};    // pipeline drenando antes de sair
+    std::atomic<uint64_t> warmup_cycles{0};          // acessos extras com a cache fria
+
+    // Interrupções e traps (InterruptController)
+    std::atomic<uint64_t> traps{0};                  // entradas em tratadores
+    std::atomic<uint64_t> interrupt_cycles{0};       // ciclos dos tratadores
+    int last_core = -1;                              // roteamento do fim de I/O
+
+    // Perfil de instruções por classe e por PC (desligado por padrão)
+    InstructionProfile profile;
 
     // Pesos de memória (configuráveis por JSON)
     MemWeights memWeights;
@@ -9,6 +9,7 @@
 #include "IO/IOManager.hpp"
 #include "multicore/MultiCore.hpp"
 #include "multicore/Scheduler.hpp"
+#include "multicore/core_loader.hpp"
 #include "cpu/PCB.hpp"
 #include "cpu/pcb_loader.hpp"
 #include "metrics/Metrics.hpp"
@@ -70,9 +71,93 @@ int main(int argc, char** argv) {
     const size_t SEC_SIZE       = 8192;   // em WORDS
     const size_t CACHE_CAP      = 64;
     const uint32_t PART_SIZE    = 512;
+    MemoryMode memMode          = MemoryMode::FIXED_PARTITIONS; // VARIABLE_PARTITIONS, BUDDY ou PAGING
+    FitStrategy fitStrategy     = FitStrategy::FIRST_FIT;  // modo VARIABLE_PARTITIONS
+    const bool COMPACTION       = true;   // compacta quando só a soma dos buracos serve
+    const uint32_t BUDDY_MIN_BLOCK = 16;  // menor bloco do buddy (em WORDS)
+    const uint32_t PAGE_SIZE    = 16;     // em WORDS (modo PAGING)
+    const size_t TLB_ENTRIES    = 16;     // entradas por core
+    const size_t TLB_WAYS       = 4;      // associatividade da TLB
+    const uint64_t TLB_HIT_CYCLES  = 0;
+    const uint64_t TLB_MISS_CYCLES = 5;   // page walk
+    const bool DEMAND_PAGING    = true;   // modo PAGING: páginas no swap até a 1ª falta
+    PageReplacementPolicy pageReplacement = PageReplacementPolicy::CLOCK;
+    const uint64_t WS_WINDOW    = 50;     // tau do working set / WSClock (ticks)
+    const std::string SWAP_FILE = "";     // ex: "output/swap.bin" (vazio = swap em vetor)
+    const size_t SWAP_FILE_WORDS = size_t(1) << 24;  // 64 MiB esparsos
+    const uint64_t DMA_SETUP_CYCLES = 0;  // custo fixo por transferência de carga
+    const uint64_t DMA_WORDS_PER_CYCLE = 0; // banda do DMA (0 = carga sem custo)
+    const bool SHARED_CODE      = true;   // uma cópia física por programa idêntico
+    const bool CODE_COPY_ON_WRITE = false; // PAGING: escrita no código copia a página
     size_t NCORES                = 4;  // Padrão: 4 cores
 
     CachePolicyType cachePolicy = CachePolicyType::FIFO;  // Cache com FIFO ou LRU
+    WritePolicy writePolicy = WritePolicy::WRITE_BACK;    // WRITE_BACK ou WRITE_THROUGH
+    const size_t WRITE_BUF_CAP     = 8;   // entradas do write buffer (0 = sem buffer)
+    const uint64_t WRITE_BUF_DRAIN = 5;   // ciclos por entrada drenada
+    const size_t VICTIM_CAP        = 0;   // linhas da victim cache (0 = desativada)
+    const bool MISS_RATIO_CURVE    = true; // curva de miss LRU para todas as capacidades
+    const bool CACHE_HEATMAP       = true; // hits/misses/expulsões por região e partição
+    const bool PROFILE_INSTRUCTIONS = true; // mix e hotspots por PC de cada processo
+    const uint32_t HEATMAP_BUCKET_WORDS = 64; // tamanho da região (palavras)
+    const uint64_t HEATMAP_WINDOW  = 10;  // ciclos por janela de tempo
+    const size_t HEATMAP_SETS      = 0;   // > 0: agrupa por conjunto (endereço % sets)
+    const std::string MEM_TRACE_FILE = "";  // ex: "output/mem_trace.bin" (vazio = sem trace)
+    const bool MEMORY_BUS          = true; // contenção entre cores no barramento/bancos
+    MemoryBusConfig busConfig;
+    busConfig.accessesPerCycle = 2;        // banda: acessos à RAM por ciclo
+    busConfig.banks            = 8;
+    busConfig.interleaveWords  = 1;        // palavras consecutivas em bancos vizinhos
+    busConfig.rowWords         = 64;       // row buffer por banco
+    busConfig.rowHitCycles     = 1;
+    busConfig.rowMissCycles    = 4;
+    const size_t NUMA_NODES        = 1;    // nós de memória (1 = sem NUMA)
+    const NumaPlacement NUMA_PLACEMENT = NumaPlacement::FIRST_TOUCH; // ou INTERLEAVED
+    const uint64_t NUMA_LOCAL_CYCLES  = 0;  // custo extra de acesso ao próprio nó
+    const uint64_t NUMA_REMOTE_CYCLES = 10; // custo extra de acesso a outro nó
+    const bool NUMA_AFFINITY       = true; // escalonador prefere processos do nó do core
+    BranchPredictorConfig branchConfig;    // preditor de desvios de cada core
+    branchConfig.type        = BranchPredictorType::TOURNAMENT; // STATIC_NOT_TAKEN, BIMODAL, GSHARE
+    branchConfig.tableBits   = 10;        // 1024 contadores de 2 bits por tabela
+    branchConfig.historyBits = 10;        // histórico global do gshare
+    branchConfig.btbEntries  = 64;
+    branchConfig.rasDepth    = 8;
+    const bool FORWARDING          = true; // false: todo RAW espera o WB (bolhas)
+    IssueConfig issueConfig;               // largura de despacho de cada core
+    issueConfig.width    = 1;              // 2+ = superescalar em ordem
+    issueConfig.alus     = 2;
+    issueConfig.memPorts = 1;
+    OutOfOrderConfig oooConfig;            // backend fora de ordem (usa issueConfig)
+    oooConfig.enabled    = false;
+    oooConfig.robEntries = 32;
+    oooConfig.rsEntries  = 16;
+    oooConfig.lsqEntries = 16;
+    const size_t SMT_CONTEXTS      = 1;    // processos por core (2–4 = SMT)
+    const SmtFetchPolicy SMT_POLICY = SmtFetchPolicy::ICOUNT; // ou ROUND_ROBIN
+    EnergyConfig energyConfig;             // energia (nJ) e DVFS de cada core
+    energyConfig.enabled  = true;
+    energyConfig.governor = DvfsGovernor::PERFORMANCE; // POWERSAVE ou ONDEMAND
+    energyConfig.levels   = {{0.5, 0.8}, {0.75, 0.9}, {1.0, 1.0}}; // freq relativa, tensão (V)
+    energyConfig.transitionTicks = 2;      // core parado a cada troca de nível
+    energyConfig.window   = 10;            // ticks por decisão do ondemand
+    ContextSwitchConfig switchConfig;      // custo da troca de contexto
+    switchConfig.enabled           = true;
+    switchConfig.cyclesPerRegister = 1;    // 38 registradores (32 GPRs + 6 especiais)
+    switchConfig.lazyRegisters     = true; // salva só os GPRs escritos
+    switchConfig.flushCache        = false;
+    switchConfig.flushTLB          = false;
+    switchConfig.warmupAccesses    = 8;    // acessos com a cache "fria" após entrar
+    switchConfig.warmupCycles      = 2;
+    InterruptConfig interruptConfig;       // timer por core, fim de I/O e traps
+    interruptConfig.enabled          = true;
+    interruptConfig.timerLatency     = 10; // ciclos de cada tratador (vetores)
+    interruptConfig.ioLatency        = 8;
+    interruptConfig.pageFaultLatency = 20;
+    interruptConfig.syscallLatency   = 6;
+    interruptConfig.ioRouting        = IoRouting::LAST_CORE; // FIXED ou ROUND_ROBIN
+    const std::string CORE_CONFIG_FILE = ""; // ex: "config/cores_big_little.json" (vazio = NCORES iguais)
+    const bool ASYMMETRIC_SCHED    = true; // cores heterogêneos: big → CPU-bound, LITTLE → IO-bound
+    const uint64_t IO_BOUND_BURST  = 40;   // ciclos médios entre bloqueios de I/O (IO-bound abaixo disso)
     SchedPolicy policy = SchedPolicy::FCFS;
 
     // Detectar argumentos: política e número de cores
@@ -112,15 +197,93 @@ int main(int argc, char** argv) {
     cout << "[main] Arquivos carregados:\n";
     for (auto &f : files) cout << "   " << f << "\n";
 
+    // ------------------------ CORES HETEROGÊNEOS ------------------------
+    vector<CoreProfile> coreProfiles;
+    if (!CORE_CONFIG_FILE.empty()) {
+        fs::path cfg = CORE_CONFIG_FILE;
+        if (!fs::exists(cfg) && fs::exists(fs::path("..") / cfg)) cfg = fs::path("..") / cfg;
+
+        if (load_core_profiles_from_json(cfg.string(), coreProfiles)) {
+            NCORES = 0;
+            for (auto &p : coreProfiles) NCORES += p.count;
+            cout << "[main] Cores de " << cfg.string() << ":";
+            for (auto &p : coreProfiles)
+                cout << " " << p.count << "x " << p.name << " (clock " << p.clock
+                     << ", potência " << p.power << ")";
+            cout << "\n";
+        } else {
+            cerr << "[main] Aviso: " << CORE_CONFIG_FILE << " inválido, usando "
+                 << NCORES << " cores iguais\n";
+        }
+    }
+
     // ------------------------ COMPONENTES ------------------------
 
-    MemoryManager memory(RAM_SIZE, SEC_SIZE, CACHE_CAP,cachePolicy);
+    MemoryManager memory(RAM_SIZE, SEC_SIZE, CACHE_CAP, cachePolicy,
+                         writePolicy, WRITE_BUF_CAP, WRITE_BUF_DRAIN);
+    memory.setVictimCache(VICTIM_CAP);
+    memory.setDMACost(DMA_SETUP_CYCLES, DMA_WORDS_PER_CYCLE);
+    if (MISS_RATIO_CURVE) memory.enableStackProfiler();
+    if (CACHE_HEATMAP)
+        memory.enableCacheHeatmap(HEATMAP_BUCKET_WORDS, HEATMAP_WINDOW, HEATMAP_SETS);
+    if (MEMORY_BUS) memory.enableMemoryBus(busConfig, NCORES);
+
+    if (!MEM_TRACE_FILE.empty()) {
+        fs::path tracePath(MEM_TRACE_FILE);
+        if (tracePath.has_parent_path())
+            fs::create_directories(tracePath.parent_path());
+        if (!memory.enableTrace(MEM_TRACE_FILE))
+            cerr << "[main] Aviso: trace de memória desativado\n";
+    }
+
+    if (!SWAP_FILE.empty()) {
+        fs::path swapPath(SWAP_FILE);
+        if (swapPath.has_parent_path())
+            fs::create_directories(swapPath.parent_path());
+        if (!memory.useSecondaryBackingFile(SWAP_FILE, SWAP_FILE_WORDS))
+            cerr << "[main] Aviso: swap em arquivo indisponível, usando vetor\n";
+    }
+
+    if (memMode == MemoryMode::PAGING) {
+        memory.createFrames(PAGE_SIZE);
+        memory.configureTLB(NCORES, TLB_ENTRIES, TLB_WAYS,
+                            TLB_HIT_CYCLES, TLB_MISS_CYCLES);
+        if (DEMAND_PAGING)
+            memory.enableDemandPaging(pageReplacement, WS_WINDOW);
+    } else if (memMode == MemoryMode::VARIABLE_PARTITIONS) {
+        memory.createVariablePartitions(fitStrategy, COMPACTION);
+    } else if (memMode == MemoryMode::BUDDY) {
+        memory.createBuddy(BUDDY_MIN_BLOCK);
+    } else {
+        memory.createPartitions(PART_SIZE);
+    }
 
-    memory.createPartitions(PART_SIZE);
+    if (SHARED_CODE) memory.enableSharedCode(CODE_COPY_ON_WRITE);
+    if (NUMA_NODES > 1)
+        memory.enableNuma(NUMA_NODES, NUMA_PLACEMENT, NUMA_LOCAL_CYCLES, NUMA_REMOTE_CYCLES);
 
     IOManager ioManager;
     Scheduler scheduler(policy);
-    MultiCore multicore(NCORES, &memory, &ioManager, nullptr);
+    MultiCore multicore = coreProfiles.empty()
+        ? MultiCore(NCORES, &memory, &ioManager, nullptr)
+        : MultiCore(coreProfiles, &memory, &ioManager, nullptr);
+    if (NUMA_NODES > 1) multicore.assignNumaNodes(NUMA_NODES);
+    multicore.configureBranchPredictors(branchConfig);
+    multicore.setForwarding(FORWARDING);
+    if (coreProfiles.empty()) {
+        // cores iguais; com perfis, issue/OoO/SMT vêm do arquivo
+        multicore.configureIssue(issueConfig);
+        multicore.configureOutOfOrder(oooConfig);
+        multicore.configureSMT(SMT_CONTEXTS, SMT_POLICY);
+    }
+    multicore.configureEnergy(energyConfig);
+    multicore.configureContextSwitch(switchConfig);
+    multicore.configureInterrupts(interruptConfig);
+    if (InterruptController* irq = multicore.getInterruptController()) {
+        // Fim de I/O vira interrupção; o tratador devolve o processo aos prontos
+        ioManager.setReadyCallback([irq](PCB* p) { irq->raiseIO(p); });
+    }
+    scheduler.setAsymmetric(ASYMMETRIC_SCHED && multicore.isHeterogeneous(), IO_BOUND_BURST);
 
     // Coletor de métricas temporais
     TemporalMetricsCollector temporalCollector(NCORES, RAM_SIZE);
@@ -145,6 +308,10 @@ int main(int argc, char** argv) {
         up->arrival_time = arrival_delay;
         arrival_delay += 2; // Delay de 2 ciclos entre chegadas
 
+        // Vetores do perfil cobrem o CODE (offset = pc - initial_pc)
+        if (PROFILE_INSTRUCTIONS)
+            up->profile.enable(up->initial_pc, up->code_bytes);
+
         pcbPtrs.push_back(up.get());
         allPCBs.push_back(std::move(up));
     }
@@ -158,35 +325,21 @@ int main(int argc, char** argv) {
     vector<PCB*> pending;
 
     for (PCB* p : pcbPtrs) {
-        // REQUISIÇÃO DE TAMANHO EM WORDS (cada elemento data/code já é contado em words)
-        uint32_t req = p->data_bytes + p->code_bytes;
-        if (req == 0) req = 1; // reservar ao menos 1 palavra
-
-        Partition* part = memory.allocateFixedPartition(*p, req);
-
-        if (!part) {
+        // Aloca DATA + CODE (em words) e carrega em bloco (DMA), sem
+        // passar pela cache; initial_pc = início do CODE. Processos só
+        // entram depois do seu tempo de chegada.
+        if (p->arrival_time > tick || !memory.loadProgram(*p)) {
             pending.push_back(p);
             continue;
         }
 
-        // DATA (cada índice é uma word index)
-        for (uint32_t i = 0; i < p->data_bytes; i++)
-            memory.writeLogical(i, p->dataSegment[i], *p);
-
-        // CODE (base em words = data_bytes)
-        uint32_t code_base = p->data_bytes;
-        for (uint32_t i = 0; i < p->code_bytes; i++)
-            memory.writeLogical(code_base + i, p->codeSegment[i], *p);
-
-        // initial_pc em WORDS (PC aponta para início do código em índice de palavra)
-        p->initial_pc = p->data_bytes;
-
         scheduler.add(p);
     }
 
     // fetchNext wrapper
-    auto fetchNext = [&](Scheduler &sched, uint64_t T) {
-        PCB* p = sched.fetchNext();
+    auto fetchNext = [&](Scheduler &sched, uint64_t T, const Core &core) {
+        int node = NUMA_AFFINITY ? core.getNumaNode() : -1;
+        PCB* p = sched.fetchNext(node, core.getCoreClass());
         if (p && p->start_time == 0) {
             p->start_time = T;
             p->response_time = T - p->arrival_time;
@@ -198,31 +351,18 @@ int main(int argc, char** argv) {
     while (!scheduler.empty()
            || multicore.hasActiveCores()
            || !pending.empty()
-           || ioManager.pendingCount() > 0) {
+           || ioManager.pendingCount() > 0
+           || memory.pageWaitingCount() > 0) {
 
         // tentar alocar pendentes
         if (!pending.empty()) {
             vector<PCB*> remain;
 
             for (PCB* p : pending) {
-                uint32_t req = p->data_bytes + p->code_bytes;
-                if (req == 0) req = 1;
-
-                Partition* part = memory.allocateFixedPartition(*p, req);
-
-                if (!part) {
+                if (p->arrival_time > tick || !memory.loadProgram(*p)) {
                     remain.push_back(p);
                     continue;
                 }
-
-                for (uint32_t i = 0; i < p->data_bytes; i++)
-                    memory.writeLogical(i, p->dataSegment[i], *p);
-
-                uint32_t code_base = p->data_bytes;
-                for (uint32_t i = 0; i < p->code_bytes; i++)
-                    memory.writeLogical(code_base + i, p->codeSegment[i], *p);
-
-                p->initial_pc = p->data_bytes;
                 scheduler.add(p);
             }
 
@@ -230,8 +370,8 @@ int main(int argc, char** argv) {
         }
 
         // enviar processos para núcleos
-        multicore.assignReadyProcesses([&]() {
-            return fetchNext(scheduler, tick);
+        multicore.assignReadyProcesses([&](const Core &core) {
+            return fetchNext(scheduler, tick, core);
         });
 
         // avançar núcleos
@@ -249,18 +389,26 @@ int main(int argc, char** argv) {
 
                 p->wait_time = (ta > service ? ta - service : 0);
 
-                memory.freePartition(p->pid);
+                memory.freeProcess(*p);
                 completed_count++;
             }
+            else if (ev.type == CoreEvent::BLOCKED && p->page_fault_wait.load() > 0) {
+                memory.blockOnPageFault(p);
+            }
             else if (ev.type == CoreEvent::BLOCKED) {
                 ioManager.registerProcessWaitingForIO(ev.pcb, std::move(ev.ioRequests), 120);
             }
-            else if (ev.type == CoreEvent::PREEMPTED) {
+            else if (ev.type == CoreEvent::PREEMPTED || ev.type == CoreEvent::IO_COMPLETE) {
                 scheduler.add(ev.pcb);
             }
         }
 
         ioManager.step();
+        memory.tick();   // drenagem do write buffer em segundo plano
+
+        // páginas que chegaram do swap liberam seus processos
+        for (PCB* p : memory.takePageReady())
+            scheduler.add(p);
         
         // Coletar métricas temporais (a cada 10 ticks para não gerar arquivo muito grande)
         if (tick % 10 == 0) {
@@ -271,12 +419,109 @@ int main(int argc, char** argv) {
     }
 
     // ------------------------ FLUSH CACHE ------------------------
-    for (auto &p : memory.L1_cache->dirtyData())
-        memory.writeToFile(p.first, p.second);
+    memory.flush();
+
+    if (const TraceWriter* tw = memory.getTraceWriter()) {
+        cout << "[main] Trace de memória: " << tw->get_records() << " acessos em "
+             << MEM_TRACE_FILE << "\n";
+        memory.closeTrace();
+    }
+
+    if (memory.get_dmaCycles() > 0) {
+        cout << "[main] Carga por DMA: " << memory.get_dmaCycles() << " ciclos\n";
+    }
+
+    if (memory.get_compactions() > 0) {
+        cout << "[main] Compactação: " << memory.get_compactions() << " passadas, "
+             << memory.get_compactedWords() << " palavras movidas\n";
+    }
+
+    if (const MemoryBus* bus = memory.getMemoryBus()) {
+        auto t = bus->totals();
+        cout << "[main] Barramento de memória: " << t.requests << " acessos, "
+             << t.queueCycles << " ciclos de fila (máx " << bus->get_maxQueueCycles()
+             << "), row hit/miss " << t.rowHits << " / " << t.rowMisses << "\n";
+    }
+
+    {
+        uint64_t branches = 0, mispred = 0;
+        for (auto &p : allPCBs) {
+            branches += p->branches.load();
+            mispred  += p->branch_mispredictions.load();
+        }
+        if (branches > 0)
+            cout << "[main] Desvios: " << branches << " resolvidos, " << mispred
+                 << " previsões erradas (" << 100.0 * (branches - mispred) / branches
+                 << "% de acerto)\n";
+    }
+
+    if (memory.getNuma()) {
+        uint64_t local = 0, remote = 0;
+        for (auto &p : allPCBs) {
+            local  += p->numa_local_accesses.load();
+            remote += p->numa_remote_accesses.load();
+        }
+        cout << "[main] NUMA: " << memory.getNuma()->numNodes() << " nós, "
+             << local << " acessos locais, " << remote << " remotos\n";
+    }
+
+    if (memory.get_sharedReuses() > 0) {
+        cout << "[main] Código compartilhado: " << memory.get_sharedReuses()
+             << " cargas reaproveitadas, " << memory.get_sharedWordsSaved()
+             << " palavras poupadas, " << memory.get_cowCopies() << " cópias COW\n";
+    }
+
+    if (memory.isDemandPaging()) {
+        cout << "[main] Paginação sob demanda: " << memory.get_pageIns()
+             << " page-ins, " << memory.get_pageOuts() << " page-outs\n";
+    }
+
+    if (multicore.isHeterogeneous()) {
+        double energy = 0.0;
+        for (auto &c : multicore.getCores()) energy += c->getEnergy();
+        cout << "[main] Cores heterogêneos: energia relativa " << energy << ", "
+             << (energy > 0 ? 1000.0 * completed_count / energy : 0.0)
+             << " processos por 1000 unidades"
+             << (scheduler.isAsymmetric() ? " (escalonamento assimétrico)" : "") << "\n";
+    }
+
+    if (switchConfig.enabled) {
+        uint64_t switches = 0, overhead = 0;
+        for (auto &c : multicore.getCores()) {
+            switches += c->context_switches;
+            overhead += c->switch_cycles + c->drain_cycles + c->warmup_cycles;
+        }
+        cout << "[main] Trocas de contexto: " << switches << " (" << overhead
+             << " ciclos de salvar/restaurar, drenagem e warm-up"
+             << (switchConfig.lazyRegisters ? ", lazy" : "") << ")\n";
+    }
+
+    if (const InterruptController* irq = multicore.getInterruptController()) {
+        uint64_t count = 0, cycles = 0;
+        for (const auto &s : irq->getStats()) {
+            count += s.total();
+            cycles += s.handlerCycles;
+        }
+        uint64_t coreTicks = tick * multicore.numCores();
+        cout << "[main] Interrupções/traps: " << count << " ("
+             << (coreTicks ? 1000.0 * count / coreTicks : 0.0) << " por 1000 ticks de core, "
+             << cycles << " ciclos de tratador = "
+             << (coreTicks ? 100.0 * cycles / coreTicks : 0.0) << "% do tempo dos cores)\n";
+    }
+
+    const double energyJoules = multicore.totalEnergyNj() * 1e-9;
+    if (energyConfig.enabled) {
+        double seconds = tick * energyConfig.tickSeconds;
+        cout << "[main] Energia (" << governorName(energyConfig.governor) << "): "
+             << energyJoules << " J, potência média "
+             << (seconds > 0 ? energyJoules / seconds : 0.0) << " W, EDP "
+             << energyJoules * seconds << " J·s\n";
+    }
 
     // ------------------------ MÉTRICAS ------------------------
     auto reports = Metrics::collect(allPCBs);
-    auto core_reports = Metrics::collectCores(multicore.getCores());
+    auto core_reports = Metrics::collectCores(multicore.getCores(), memory.getMemoryBus(),
+                                              multicore.getInterruptController());
 
 
     // Criar diretório output se não existir (no diretório de trabalho atual)
@@ -305,12 +550,20 @@ int main(int argc, char** argv) {
 
     // Salvar métricas básicas (com nome da política)
     Metrics::printConsole(reports);
+
+    // Tempo e IPC de cada core
+    Metrics::printCoreMetrics(core_reports);
+
+    // Métricas da hierarquia de cache (3C + victim cache)
+    auto cache_report = Metrics::collectCache(reports, memory);
+    Metrics::printCacheMetrics(cache_report);
+    Metrics::saveCacheCSV(cache_report, reports, policyDir + "/cache_metrics.csv");
     //Metrics::saveCSV(reports, policyDir + "/metrics.csv");
     //Metrics::saveJSON(reports, policyDir + "/metrics.json");
 
     // Calcular e salvar métricas agregadas por política
     auto policyMetrics = MetricsExtended::calculatePolicyMetrics(
-        reports, policy, tick, NCORES
+        reports, policy, tick, NCORES, energyJoules, energyConfig.tickSeconds
     );
     std::vector<MetricsExtended::PolicyMetrics> policyVec = {policyMetrics};
     MetricsExtended::printPolicyMetrics(policyVec);
@@ -324,6 +577,36 @@ int main(int argc, char** argv) {
     
     MetricsExtended::savePolicyMetricsCSV(policyVec, "output/policy_metrics.csv");
 
+    // Curva de miss (stack distance) ao lado do policy_metrics.csv
+    if (const StackDistanceProfiler* sdp = memory.getStackProfiler()) {
+        sdp->saveMissRatioCSV(policyDir + "/miss_ratio_curve.csv");
+        sdp->saveMissRatioCSV("output/miss_ratio_curve.csv");
+    }
+
+    // Mapa de calor da cache: matriz janela × bucket, partições e resumo
+    if (const CacheHeatmap* hm = memory.getCacheHeatmap()) {
+        hm->saveMatrixCSV(policyDir + "/cache_heatmap.csv");
+        hm->savePartitionCSV(policyDir + "/cache_heatmap_partitions.csv");
+        hm->saveSummary(policyDir + "/cache_heatmap_summary.txt");
+        hm->saveMatrixCSV("output/cache_heatmap.csv");
+        hm->savePartitionCSV("output/cache_heatmap_partitions.csv");
+        hm->saveSummary("output/cache_heatmap_summary.txt");
+
+        auto hot = hm->hottest(1);
+        if (!hot.empty())
+            cout << "[main] Mapa de calor da cache: bucket mais acessado b" << hot[0].bucket
+                 << " (" << hot[0].total.accesses() << " acessos), "
+                 << hm->thrashing(hm->get_numBuckets()).size() << " em thrashing\n";
+    }
+
+    // Perfil de instruções: hotspots (texto) e pilhas para flamegraph
+    if (PROFILE_INSTRUCTIONS) {
+        Metrics::saveHotspotReport(reports, policyDir + "/hotspots.txt");
+        Metrics::saveFoldedStacks(reports, policyDir + "/profile.folded");
+        Metrics::saveHotspotReport(reports, "output/hotspots.txt");
+        Metrics::saveFoldedStacks(reports, "output/profile.folded");
+    }
+
     // Comparação Single-Core vs Multicore
     // Criar para qualquer número de cores (incluindo 1 core como baseline)
     MetricsExtended::CoreComparison core_comp;
@@ -356,6 +639,13 @@ int main(int argc, char** argv) {
     cout << "  - metrics.json (métricas por processo em JSON)\n";
     cout << "  - policy_metrics.csv (métricas agregadas por política)\n";
     cout << "  - temporal_metrics.csv (evolução temporal para gráficos)\n";
+    cout << "  - cache_metrics.csv (misses 3C e victim cache)\n";
+    if (MISS_RATIO_CURVE) {
+        cout << "  - miss_ratio_curve.csv (curva de miss LRU por capacidade)\n";
+    }
+    if (PROFILE_INSTRUCTIONS) {
+        cout << "  - hotspots.txt / profile.folded (perfil por PC; flamegraph.pl profile.folded)\n";
+    }
     if (NCORES > 1) {
         cout << "  - core_comparison.csv (comparação multicore)\n";
     }
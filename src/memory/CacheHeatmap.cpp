@@ -0,0 +1,194 @@
+#include "CacheHeatmap.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+// No modo por região sobra um bucket extra no fim para endereços
+// além da RAM (memória secundária acessada diretamente).
+CacheHeatmap::CacheHeatmap(size_t memoryWords, uint32_t bucketWords_,
+                           uint64_t windowTicks_, size_t sets_)
+    : bucketWords(bucketWords_ == 0 ? 1 : bucketWords_),
+      sets(sets_),
+      windowTicks(windowTicks_ == 0 ? 1 : windowTicks_)
+{
+    if (sets > 0)
+        numBuckets = sets;
+    else
+        numBuckets = (memoryWords + bucketWords - 1) / bucketWords + 1;
+}
+
+size_t CacheHeatmap::bucketOf(uint32_t address) const {
+    if (sets > 0) return address % sets;
+    return std::min<size_t>(address / bucketWords, numBuckets - 1);
+}
+
+// Janela do tick; abre as janelas que faltam (a matriz só cresce)
+size_t CacheHeatmap::windowOf(uint64_t tick) {
+    size_t w = static_cast<size_t>(tick / windowTicks);
+    if (cells.size() < (w + 1) * numBuckets) {
+        cells.resize((w + 1) * numBuckets);
+        owners.resize(w + 1);
+    }
+    return w;
+}
+
+HeatCell& CacheHeatmap::cell(uint32_t address, uint64_t tick) {
+    return cells[windowOf(tick) * numBuckets + bucketOf(address)];
+}
+
+HeatCell* CacheHeatmap::ownerCell(int owner, uint64_t tick) {
+    if (owner < 0) return nullptr;
+    auto &row = owners[windowOf(tick)];
+    if (row.size() <= static_cast<size_t>(owner)) row.resize(owner + 1);
+    return &row[owner];
+}
+
+// --------------------------------------------------
+// Registro
+// --------------------------------------------------
+void CacheHeatmap::access(uint32_t address, int owner, bool hit, uint64_t tick) {
+    HeatCell &c = cell(address, tick);
+    HeatCell* o = ownerCell(owner, tick);
+
+    if (hit) {
+        c.hits++;
+        if (o) o->hits++;
+    } else {
+        c.misses++;
+        if (o) o->misses++;
+    }
+    lastOwner = owner;
+}
+
+void CacheHeatmap::eviction(uint32_t address, uint64_t tick) {
+    cell(address, tick).evictions++;
+    if (HeatCell* o = ownerCell(lastOwner, tick)) o->evictions++;
+}
+
+// --------------------------------------------------
+// Totais e resumo
+// --------------------------------------------------
+std::vector<HeatCell> CacheHeatmap::bucketTotals() const {
+    std::vector<HeatCell> total(numBuckets);
+    for (size_t i = 0; i < cells.size(); i++) {
+        HeatCell &t = total[i % numBuckets];
+        t.hits += cells[i].hits;
+        t.misses += cells[i].misses;
+        t.evictions += cells[i].evictions;
+    }
+    return total;
+}
+
+std::vector<HeatCell> CacheHeatmap::ownerTotals() const {
+    std::vector<HeatCell> total;
+    for (const auto &row : owners) {
+        if (total.size() < row.size()) total.resize(row.size());
+        for (size_t p = 0; p < row.size(); p++) {
+            total[p].hits += row[p].hits;
+            total[p].misses += row[p].misses;
+            total[p].evictions += row[p].evictions;
+        }
+    }
+    return total;
+}
+
+std::vector<HeatSpot> CacheHeatmap::hottest(size_t n) const {
+    std::vector<HeatSpot> spots;
+    auto total = bucketTotals();
+    for (size_t b = 0; b < total.size(); b++)
+        if (total[b].accesses() > 0) spots.push_back({b, total[b]});
+
+    std::sort(spots.begin(), spots.end(), [](const HeatSpot &a, const HeatSpot &b) {
+        return a.total.accesses() > b.total.accesses();
+    });
+    if (spots.size() > n) spots.resize(n);
+    return spots;
+}
+
+// Thrashing: linhas do bucket entram e saem (expulsões) e a maior
+// parte dos acessos erra
+std::vector<HeatSpot> CacheHeatmap::thrashing(size_t n, double minMissRate) const {
+    std::vector<HeatSpot> spots;
+    auto total = bucketTotals();
+    for (size_t b = 0; b < total.size(); b++)
+        if (total[b].evictions > 0 && total[b].missRate() >= minMissRate)
+            spots.push_back({b, total[b]});
+
+    std::sort(spots.begin(), spots.end(), [](const HeatSpot &a, const HeatSpot &b) {
+        return a.total.evictions > b.total.evictions;
+    });
+    if (spots.size() > n) spots.resize(n);
+    return spots;
+}
+
+// --------------------------------------------------
+// Arquivos
+// --------------------------------------------------
+void CacheHeatmap::saveMatrixCSV(const std::string& filename) const {
+    std::ofstream fout(filename);
+    fout << "window,start_tick,metric";
+    for (size_t b = 0; b < numBuckets; b++) fout << ",b" << b;
+    fout << "\n";
+
+    static const char* names[] = {"hits", "misses", "evictions"};
+    for (size_t w = 0; w < get_numWindows(); w++) {
+        for (int m = 0; m < 3; m++) {
+            fout << w << "," << w * windowTicks << "," << names[m];
+            for (size_t b = 0; b < numBuckets; b++) {
+                const HeatCell &c = at(w, b);
+                fout << "," << (m == 0 ? c.hits : m == 1 ? c.misses : c.evictions);
+            }
+            fout << "\n";
+        }
+    }
+}
+
+void CacheHeatmap::savePartitionCSV(const std::string& filename) const {
+    std::ofstream fout(filename);
+    fout << "window,start_tick,partition,hits,misses,evictions,miss_rate\n";
+
+    for (size_t w = 0; w < owners.size(); w++) {
+        for (size_t p = 0; p < owners[w].size(); p++) {
+            const HeatCell &c = owners[w][p];
+            if (c.accesses() == 0 && c.evictions == 0) continue;
+            fout << w << "," << w * windowTicks << "," << p << ","
+                 << c.hits << "," << c.misses << "," << c.evictions << ","
+                 << std::fixed << std::setprecision(4) << c.missRate() << "\n";
+        }
+    }
+}
+
+void CacheHeatmap::saveSummary(const std::string& filename, size_t n) const {
+    std::ofstream fout(filename);
+
+    fout << "Mapa de calor da cache: " << numBuckets
+         << (sets > 0 ? " conjuntos" : " buckets de " + std::to_string(bucketWords) + " palavras")
+         << ", " << get_numWindows() << " janelas de " << windowTicks << " ciclos\n";
+
+    auto row = [&fout](const HeatSpot &s) {
+        fout << "  b" << s.bucket << ": " << s.total.accesses() << " acessos, "
+             << s.total.misses << " misses, " << s.total.evictions << " expulsões, miss "
+             << std::fixed << std::setprecision(1) << s.total.missRate() * 100.0 << "%\n";
+    };
+
+    fout << "\nMais acessados:\n";
+    for (const auto &s : hottest(n)) row(s);
+
+    fout << "\nThrashing (expulsões com miss >= 50%):\n";
+    auto thrash = thrashing(n);
+    if (thrash.empty()) fout << "  nenhum\n";
+    for (const auto &s : thrash) row(s);
+
+    fout << "\nPor partição:\n";
+    auto parts = ownerTotals();
+    for (size_t p = 0; p < parts.size(); p++) {
+        if (parts[p].accesses() == 0) continue;
+        fout << "  p" << p << ": " << parts[p].accesses() << " acessos, "
+             << parts[p].evictions << " expulsões provocadas, miss "
+             << std::fixed << std::setprecision(1) << parts[p].missRate() * 100.0 << "%\n";
+    }
+}
@@ -0,0 +1,86 @@
+#ifndef CACHE_HEATMAP_HPP
+#define CACHE_HEATMAP_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Contadores de uma célula do mapa (bucket ou partição × janela)
+struct HeatCell {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    uint64_t accesses() const { return hits + misses; }
+    double missRate() const {
+        return accesses() ? static_cast<double>(misses) / accesses() : 0.0;
+    }
+};
+
+// Linha do resumo (bucket/conjunto com seus totais)
+struct HeatSpot {
+    size_t bucket;
+    HeatCell total;
+};
+
+// -------------------------------------------------------------
+//                     CACHE HEATMAP
+// -------------------------------------------------------------
+// Hits, misses e expulsões da L1 por região de endereço e por
+// partição, em janelas de `windowTicks` ciclos simulados.
+// - sets == 0: bucket = endereço / bucketWords (a L1 atual é
+//   totalmente associativa, então a região é o que interessa);
+// - sets > 0:  bucket = endereço % sets, o conjunto que o endereço
+//   ocuparia numa cache com esse número de conjuntos.
+// As janelas ficam numa matriz plana (janela × bucket); partições
+// (quadros, na paginação) ganham colunas sob demanda.
+// Uma expulsão conta no bucket da linha expulsa e na partição cujo
+// miss a provocou.
+class CacheHeatmap {
+private:
+    size_t numBuckets;
+    uint32_t bucketWords;
+    size_t sets;
+    uint64_t windowTicks;
+
+    std::vector<HeatCell> cells;                  // [janela * numBuckets + bucket]
+    std::vector<std::vector<HeatCell>> owners;    // [janela][partição]
+    int lastOwner = -1;
+
+    HeatCell& cell(uint32_t address, uint64_t tick);
+    HeatCell* ownerCell(int owner, uint64_t tick);
+    size_t windowOf(uint64_t tick);
+
+public:
+    CacheHeatmap(size_t memoryWords, uint32_t bucketWords = 64,
+                 uint64_t windowTicks = 10, size_t sets = 0);
+
+    size_t bucketOf(uint32_t address) const;
+
+    void access(uint32_t address, int owner, bool hit, uint64_t tick);
+    void eviction(uint32_t address, uint64_t tick);
+
+    size_t get_numBuckets() const { return numBuckets; }
+    size_t get_numWindows() const { return numBuckets ? cells.size() / numBuckets : 0; }
+    const HeatCell& at(size_t window, size_t bucket) const {
+        return cells[window * numBuckets + bucket];
+    }
+
+    // Totais de todas as janelas
+    std::vector<HeatCell> bucketTotals() const;
+    std::vector<HeatCell> ownerTotals() const;
+
+    // Mais acessados / mais expulsões com miss rate >= minMissRate
+    std::vector<HeatSpot> hottest(size_t n) const;
+    std::vector<HeatSpot> thrashing(size_t n, double minMissRate = 0.5) const;
+
+    // window,start_tick,metric,b0,b1,... — uma linha por métrica e janela
+    void saveMatrixCSV(const std::string& filename) const;
+    // window,start_tick,partition,hits,misses,evictions,miss_rate (só células usadas)
+    void savePartitionCSV(const std::string& filename) const;
+    // Texto: totais, buckets quentes e buckets em thrashing
+    void saveSummary(const std::string& filename, size_t n = 10) const;
+};
+
+#endif
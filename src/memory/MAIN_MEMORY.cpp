@@ -1,4 +1,6 @@
 #include "MAIN_MEMORY.hpp"
+#include <algorithm>
+#include <cstring>
 
 MAIN_MEMORY::MAIN_MEMORY(size_t size)
 {
@@ -7,32 +9,75 @@ MAIN_MEMORY::MAIN_MEMORY(size_t size)
     else
         this->size = size;
 
-    this->ram.resize(this->size, MEMORY_ACCESS_ERROR);
+    // Só o diretório é reservado; tabelas e pedaços vêm sob demanda
+    size_t span = size_t(1) << DIR_SHIFT;
+    this->directory.resize((this->size + span - 1) / span);
 }
 
 MAIN_MEMORY::~MAIN_MEMORY()
 {
-    this->ram.clear();
+    this->directory.clear();
 }
 
+// --------------------------------------------------
+// Acesso O(1) por shift/máscara
+// --------------------------------------------------
+const MAIN_MEMORY::Chunk* MAIN_MEMORY::findChunk(uint32_t address) const
+{
+    const auto &table = directory[address >> DIR_SHIFT];
+    if (!table) return nullptr;
+    return (*table)[(address >> CHUNK_SHIFT) & TABLE_MASK].get();
+}
+
+MAIN_MEMORY::Chunk* MAIN_MEMORY::touchChunk(uint32_t address)
+{
+    auto &table = directory[address >> DIR_SHIFT];
+    if (!table) table = std::make_unique<Table>();
+
+    auto &chunk = (*table)[(address >> CHUNK_SHIFT) & TABLE_MASK];
+    if (!chunk) {
+        chunk = std::make_unique<Chunk>();
+        chunk->fill(MEMORY_ACCESS_ERROR);
+        residentChunks++;
+    }
+    return chunk.get();
+}
+
+// Células nunca escritas valem MEMORY_ACCESS_ERROR, então basta olhar
+// os pedaços residentes
 bool MAIN_MEMORY::isEmpty()
 {
-    for (auto &val : ram)
-        if (val != MEMORY_ACCESS_ERROR) return false;
+    for (auto &table : directory) {
+        if (!table) continue;
+        for (auto &chunk : *table) {
+            if (!chunk) continue;
+            for (auto &val : *chunk)
+                if (val != MEMORY_ACCESS_ERROR) return false;
+        }
+    }
     return true;
 }
 
 bool MAIN_MEMORY::notFull()
 {
-    for (auto &val : ram)
-        if (val == MEMORY_ACCESS_ERROR) return true;
+    if (residentChunks * CHUNK_WORDS < size) return true;
+    for (auto &table : directory) {
+        if (!table) continue;
+        for (auto &chunk : *table) {
+            if (!chunk) continue;
+            for (auto &val : *chunk)
+                if (val == MEMORY_ACCESS_ERROR) return true;
+        }
+    }
     return false;
 }
 
 uint32_t MAIN_MEMORY::ReadMem(uint32_t address)
 {
-    if (address < this->size)
-        return ram[address];
+    if (address < this->size) {
+        const Chunk* chunk = findChunk(address);
+        return chunk ? (*chunk)[address & CHUNK_MASK] : MEMORY_ACCESS_ERROR;
+    }
     return MEMORY_ACCESS_ERROR;
 }
 
@@ -40,19 +85,66 @@ uint32_t MAIN_MEMORY::WriteMem(uint32_t address, uint32_t data)
 {
     if (address < this->size)
     {
-        ram[address] = data;
-        return ram[address];
+        Chunk* chunk = touchChunk(address);
+        (*chunk)[address & CHUNK_MASK] = data;
+        return data;
     }
     return MEMORY_ACCESS_ERROR;
 }
 
 uint32_t MAIN_MEMORY::DeleteData(uint32_t address)
 {
-    if (address < this->size && ram[address] != MEMORY_ACCESS_ERROR)
-    {
-        uint32_t deletedData = ram[address];
-        ram[address] = MEMORY_ACCESS_ERROR;
-        return deletedData;
+    if (address >= this->size) return MEMORY_ACCESS_ERROR;
+
+    // Não aloca: apagar uma célula nunca escrita não tem efeito
+    const Chunk* found = findChunk(address);
+    if (!found || (*found)[address & CHUNK_MASK] == MEMORY_ACCESS_ERROR)
+        return MEMORY_ACCESS_ERROR;
+
+    Chunk* chunk = touchChunk(address);
+    uint32_t deletedData = (*chunk)[address & CHUNK_MASK];
+    (*chunk)[address & CHUNK_MASK] = MEMORY_ACCESS_ERROR;
+    return deletedData;
+}
+
+// --------------------------------------------------
+// Blocos: um memcpy por pedaço atravessado
+// --------------------------------------------------
+bool MAIN_MEMORY::WriteBlock(uint32_t address, const uint32_t* src, size_t count)
+{
+    if (address > this->size || count > this->size - address)
+        return false;
+
+    size_t addr = address;
+    while (count > 0) {
+        size_t offset = addr & CHUNK_MASK;
+        size_t n = std::min<size_t>(count, CHUNK_WORDS - offset);
+        Chunk* chunk = touchChunk(static_cast<uint32_t>(addr));
+        std::memcpy(chunk->data() + offset, src, n * sizeof(uint32_t));
+        addr += n;
+        src += n;
+        count -= n;
     }
-    return MEMORY_ACCESS_ERROR;
+    return true;
+}
+
+bool MAIN_MEMORY::ReadBlock(uint32_t address, uint32_t* dst, size_t count) const
+{
+    if (address > this->size || count > this->size - address)
+        return false;
+
+    size_t addr = address;
+    while (count > 0) {
+        size_t offset = addr & CHUNK_MASK;
+        size_t n = std::min<size_t>(count, CHUNK_WORDS - offset);
+        const Chunk* chunk = findChunk(static_cast<uint32_t>(addr));
+        if (chunk)
+            std::memcpy(dst, chunk->data() + offset, n * sizeof(uint32_t));
+        else
+            std::fill(dst, dst + n, MEMORY_ACCESS_ERROR);
+        addr += n;
+        dst += n;
+        count -= n;
+    }
+    return true;
 }
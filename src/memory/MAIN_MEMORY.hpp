@@ -1,30 +1,69 @@
 #ifndef MAIN_MEMORY_HPP
 #define MAIN_MEMORY_HPP
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #define MEMORY_ACCESS_ERROR UINT32_MAX
-#define MAX_MEMORY_SIZE 1024
+#define MAX_MEMORY_SIZE (1ull << 32)   // espaço de 32 bits (em WORDS)
 
 using std::size_t;
 using std::uint32_t;
 using std::vector;
 
+// -------------------------------------------------------------
+//                     MEMÓRIA PRINCIPAL ESPARSA
+// -------------------------------------------------------------
+// Tabela de dois níveis, como uma tabela de páginas:
+//   endereço = [ diretório | tabela | deslocamento ]
+//                 12 bits   10 bits    10 bits
+// Cada pedaço (chunk) tem 1024 palavras = 4 KiB e só é alocado na
+// primeira escrita; as tabelas do segundo nível também. Ler um pedaço
+// nunca tocado devolve MEMORY_ACCESS_ERROR sem alocar nada, então o
+// consumo do host é proporcional às páginas realmente usadas.
 class MAIN_MEMORY
 {
+public:
+    static constexpr uint32_t CHUNK_SHIFT = 10;
+    static constexpr uint32_t CHUNK_WORDS = 1u << CHUNK_SHIFT;
+    static constexpr uint32_t CHUNK_MASK  = CHUNK_WORDS - 1;
+    static constexpr uint32_t TABLE_SHIFT = 10;
+    static constexpr uint32_t TABLE_SIZE  = 1u << TABLE_SHIFT;
+    static constexpr uint32_t TABLE_MASK  = TABLE_SIZE - 1;
+    static constexpr uint32_t DIR_SHIFT   = CHUNK_SHIFT + TABLE_SHIFT;
+
 private:
+    using Chunk = std::array<uint32_t, CHUNK_WORDS>;
+    using Table = std::array<std::unique_ptr<Chunk>, TABLE_SIZE>;
+
     size_t size;
-    vector<uint32_t> ram;
+    vector<std::unique_ptr<Table>> directory;
+    size_t residentChunks = 0;
+
     bool notFull();
     bool isEmpty();
 
+    // Pedaço que contém address (nullptr se nunca foi escrito)
+    const Chunk* findChunk(uint32_t address) const;
+    // Idem, alocando diretório/pedaço na primeira escrita
+    Chunk* touchChunk(uint32_t address);
+
 public:
     MAIN_MEMORY(size_t size);
     ~MAIN_MEMORY();
     uint32_t ReadMem(uint32_t address);
     uint32_t WriteMem(uint32_t address, uint32_t data);
     uint32_t DeleteData(uint32_t address);
+
+    // Transferência em bloco (memcpy); false se sair da memória
+    bool WriteBlock(uint32_t address, const uint32_t* src, size_t count);
+    bool ReadBlock(uint32_t address, uint32_t* dst, size_t count) const;
+
+    size_t getSize() const { return size; }
+    size_t get_residentChunks() const { return residentChunks; }
+    size_t get_residentBytes() const { return residentChunks * sizeof(Chunk); }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,74 @@
+#include "MemoryBus.hpp"
+#include <algorithm>
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+MemoryBus::MemoryBus(const MemoryBusConfig &config, size_t numCores)
+    : cfg(config),
+      perCore(numCores)
+{
+    if (cfg.accessesPerCycle == 0) cfg.accessesPerCycle = 1;
+    if (cfg.banks == 0) cfg.banks = 1;
+    if (cfg.interleaveWords == 0) cfg.interleaveWords = 1;
+    if (cfg.rowWords == 0) cfg.rowWords = 1;
+    if (cfg.rowMissCycles < cfg.rowHitCycles) cfg.rowMissCycles = cfg.rowHitCycles;
+
+    banks.resize(cfg.banks);
+}
+
+// --------------------------------------------------
+// ACESSO: barramento → banco → row buffer
+// --------------------------------------------------
+BusAccess MemoryBus::access(uint32_t address, int core, uint64_t now) {
+    BusAccess r;
+
+    // 1. Barramento: um slot por acesso, accessesPerCycle slots por ciclo
+    uint64_t slot = std::max(nextSlot, now * cfg.accessesPerCycle);
+    nextSlot = slot + 1;
+    uint64_t onBus = slot / cfg.accessesPerCycle;
+
+    // 2. Banco: intercalado a cada interleaveWords palavras
+    uint32_t stripe = address / cfg.interleaveWords;
+    Bank &bank = banks[stripe % cfg.banks];
+
+    uint64_t start = std::max(onBus, bank.busyUntil);
+    r.queueCycles = start - now;
+
+    // 3. Row buffer: linha dentro do banco
+    uint64_t local = static_cast<uint64_t>(stripe / cfg.banks) * cfg.interleaveWords
+                   + address % cfg.interleaveWords;
+    int64_t row = static_cast<int64_t>(local / cfg.rowWords);
+
+    r.rowHit = bank.openRow == row;
+    uint64_t service = r.rowHit ? cfg.rowHitCycles : cfg.rowMissCycles;
+    r.rowPenalty = service - cfg.rowHitCycles;
+
+    bank.openRow = row;
+    bank.busyUntil = start + service;
+
+    // Métricas
+    CoreStats *s = &background;
+    if (core >= 0) {
+        if (static_cast<size_t>(core) >= perCore.size()) perCore.resize(core + 1);
+        s = &perCore[core];
+    }
+    s->requests++;
+    s->queueCycles += r.queueCycles;
+    if (r.rowHit) s->rowHits++;
+    else          s->rowMisses++;
+    maxQueueCycles = std::max(maxQueueCycles, r.queueCycles);
+
+    return r;
+}
+
+MemoryBus::CoreStats MemoryBus::totals() const {
+    CoreStats t = background;
+    for (const auto &c : perCore) {
+        t.requests    += c.requests;
+        t.queueCycles += c.queueCycles;
+        t.rowHits     += c.rowHits;
+        t.rowMisses   += c.rowMisses;
+    }
+    return t;
+}
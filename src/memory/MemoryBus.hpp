@@ -0,0 +1,77 @@
+#ifndef MEMORY_BUS_HPP
+#define MEMORY_BUS_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// -------------------------------------------------------------
+//            BARRAMENTO / CONTROLADOR DE MEMÓRIA
+// -------------------------------------------------------------
+// Todos os cores dividem um barramento com banda limitada e uma RAM
+// dividida em bancos intercalados, cada um com seu row buffer.
+// Um acesso à memória primária no tick `now`:
+//   1. espera um slot livre no barramento (fila FCFS, banda de
+//      accessesPerCycle acessos por ciclo);
+//   2. espera o banco terminar o acesso anterior;
+//   3. ocupa o banco por rowHitCycles (linha já aberta) ou
+//      rowMissCycles (precharge + activate de outra linha).
+// O custo devolvido (fila + penalidade de row miss) é somado ao
+// custo fixo memWeights.primary de quem fez o acesso.
+struct MemoryBusConfig {
+    uint32_t accessesPerCycle = 1;   // banda do barramento
+    uint32_t banks = 4;
+    uint32_t interleaveWords = 1;    // palavras consecutivas no mesmo banco
+    uint32_t rowWords = 64;          // tamanho do row buffer (por banco)
+    uint64_t rowHitCycles = 1;
+    uint64_t rowMissCycles = 4;
+};
+
+struct BusAccess {
+    uint64_t queueCycles = 0;   // espera no barramento + no banco
+    uint64_t rowPenalty = 0;    // rowMissCycles - rowHitCycles (0 num hit)
+    bool rowHit = false;
+
+    uint64_t total() const { return queueCycles + rowPenalty; }
+};
+
+class MemoryBus {
+public:
+    struct CoreStats {
+        uint64_t requests = 0;
+        uint64_t queueCycles = 0;
+        uint64_t rowHits = 0;
+        uint64_t rowMisses = 0;
+    };
+
+private:
+    struct Bank {
+        uint64_t busyUntil = 0;
+        int64_t openRow = -1;
+    };
+
+    MemoryBusConfig cfg;
+    std::vector<Bank> banks;
+
+    // Próximo slot livre, em unidades de 1/accessesPerCycle ciclo
+    uint64_t nextSlot = 0;
+
+    std::vector<CoreStats> perCore;
+    CoreStats background;           // drenagem do write buffer, carga etc.
+    uint64_t maxQueueCycles = 0;
+
+public:
+    explicit MemoryBus(const MemoryBusConfig &config = MemoryBusConfig(),
+                       size_t numCores = 1);
+
+    // Agenda um acesso de `core` (-1 = sem core) no tick `now`
+    BusAccess access(uint32_t address, int core, uint64_t now);
+
+    const MemoryBusConfig& config() const { return cfg; }
+    const std::vector<CoreStats>& get_coreStats() const { return perCore; }
+    const CoreStats& get_backgroundStats() const { return background; }
+    CoreStats totals() const;
+    uint64_t get_maxQueueCycles() const { return maxQueueCycles; }
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "MemoryManager.hpp"
+#include <algorithm>
 
 // -------------------------------------------------------------
 //                   CONSTRUTOR COMPLETO
@@ -6,7 +7,13 @@
 MemoryManager::MemoryManager(size_t mainMemorySize,
                              size_t secondaryMemorySize,
                              size_t cacheCapacity,
-                             CachePolicyType cachePolicy)
+                             CachePolicyType cachePolicy,
+                             WritePolicy writePolicy_,
+                             size_t writeBufferCapacity,
+                             uint64_t writeBufferDrainInterval)
+    : writePolicy(writePolicy_),
+      writeBuffer(writeBufferCapacity, writeBufferDrainInterval),
+      missClassifier(cacheCapacity)
 {
     mainMemory = std::make_unique<MAIN_MEMORY>(mainMemorySize);
     secondaryMemory = std::make_unique<SECONDARY_MEMORY>(secondaryMemorySize);
@@ -14,7 +21,8 @@ MemoryManager::MemoryManager(size_t mainMemorySize,
     // Cache com FIFO ou LRU
     L1_cache = std::make_unique<Cache>(cacheCapacity, cachePolicy);
 
-    mainMemoryLimit = mainMemorySize;
+    mainMemoryLimit = mainMemory->getSize();
+    secondaryMemoryLimit = std::min<size_t>(secondaryMemorySize, MAX_SECONDARY_MEMORY_SIZE);
 }
 
 
@@ -37,15 +45,23 @@ void MemoryManager::createPartitions(uint32_t partitionSize) {
 // -------------------------------------------------------------
 Partition* MemoryManager::allocateFixedPartition(PCB &pcb, uint32_t sizeRequired) {
 
-    for (auto &p : partitions) {
-        if (p.free && p.size >= sizeRequired) {
+    // NUMA: primeiro uma partição no nó do processo, depois qualquer uma
+    int node = homeNode(pcb);
+
+    for (int pass = node >= 0 ? 0 : 1; pass < 2; pass++) {
+        for (auto &p : partitions) {
+            if (!p.free || p.size < sizeRequired) continue;
+            if (pass == 0 && numa->nodeOf(p.base) != node) continue;
 
             p.free = false;
             p.pid = pcb.pid;
+            p.used = sizeRequired;
+            p.owner = &pcb;
 
             pcb.partition_id   = &p - &partitions[0];  // id
             pcb.partition_base = p.base;
             pcb.partition_size = p.size;
+            pcb.segment = {p.base, p.size, true};
 
             return &p;
         }
@@ -57,17 +73,1017 @@ Partition* MemoryManager::allocateFixedPartition(PCB &pcb, uint32_t sizeRequired
 void MemoryManager::freePartition(int pid) {
     for (auto &p : partitions) {
         if (p.pid == pid) {
+            if (p.owner) p.owner->segment.valid = false;
             p.free = true;
             p.pid  = -1;
+            p.used = 0;
+            p.owner = nullptr;
+        }
+    }
+}
+
+// -------------------------------------------------------------
+//               PARTIÇÕES VARIÁVEIS
+// -------------------------------------------------------------
+// partitions guarda blocos ocupados e buracos, ordenados por base.
+// Alocação divide um buraco; liberação junta buracos vizinhos.
+void MemoryManager::createVariablePartitions(FitStrategy fit, bool compaction) {
+    mode = MemoryMode::VARIABLE_PARTITIONS;
+    fitStrategy = fit;
+    compactionEnabled = compaction;
+    nextFitBase = 0;
+
+    partitions.clear();
+    partitions.emplace_back(0, mainMemoryLimit);
+}
+
+// Índice do buraco escolhido pela estratégia (-1 se nenhum cabe)
+int MemoryManager::findHole(uint32_t sizeRequired, int node) const {
+    int chosen = -1;
+    const int n = static_cast<int>(partitions.size());
+
+    // NUMA: só buracos que começam no nó pedido (-1 = qualquer)
+    auto fits = [&](const Partition &p) {
+        return p.free && p.size >= sizeRequired
+               && (node < 0 || numa->nodeOf(p.base) == node);
+    };
+
+    if (fitStrategy == FitStrategy::NEXT_FIT) {
+        // Começa no primeiro bloco a partir do ponteiro e dá a volta
+        int start = 0;
+        while (start < n && partitions[start].base < nextFitBase) start++;
+
+        for (int k = 0; k < n; k++) {
+            int i = (start + k) % n;
+            if (fits(partitions[i]))
+                return i;
+        }
+        return -1;
+    }
+
+    for (int i = 0; i < n; i++) {
+        const Partition &p = partitions[i];
+        if (!fits(p)) continue;
+
+        if (fitStrategy == FitStrategy::FIRST_FIT) return i;
+
+        if (chosen < 0
+            || (fitStrategy == FitStrategy::BEST_FIT  && p.size < partitions[chosen].size)
+            || (fitStrategy == FitStrategy::WORST_FIT && p.size > partitions[chosen].size))
+            chosen = i;
+    }
+    return chosen;
+}
+
+Partition* MemoryManager::allocateVariablePartition(PCB &pcb, uint32_t sizeRequired) {
+
+    if (sizeRequired == 0) sizeRequired = 1;
+
+    int node = homeNode(pcb);
+    int idx = node >= 0 ? findHole(sizeRequired, node) : -1;
+    if (idx < 0) idx = findHole(sizeRequired);
+
+    // Nenhum buraco serve mas a soma do livre serve: compacta
+    if (idx < 0 && compactionEnabled && fragmentation().freeWords >= sizeRequired) {
+        compact();
+        idx = findHole(sizeRequired);
+    }
+    if (idx < 0) return nullptr;
+
+    // Sobra do buraco vira um novo buraco logo depois
+    if (partitions[idx].size > sizeRequired) {
+        Partition rest(partitions[idx].base + sizeRequired,
+                       partitions[idx].size - sizeRequired);
+        partitions[idx].size = sizeRequired;
+        partitions.insert(partitions.begin() + idx + 1, rest);
+    }
+
+    Partition &p = partitions[idx];
+    p.free = false;
+    p.pid = pcb.pid;
+    p.used = sizeRequired;
+    p.owner = &pcb;
+
+    nextFitBase = p.base + p.size;
+
+    pcb.partition_id   = idx;
+    pcb.partition_base = p.base;
+    pcb.partition_size = p.size;
+    pcb.segment = {p.base, p.size, true};
+    return &p;
+}
+
+void MemoryManager::freeVariablePartition(int pid) {
+    for (size_t i = 0; i < partitions.size(); i++) {
+        if (partitions[i].pid != pid) continue;
+
+        if (partitions[i].owner) partitions[i].owner->segment.valid = false;
+        partitions[i].free = true;
+        partitions[i].pid = -1;
+        partitions[i].used = 0;
+        partitions[i].owner = nullptr;
+
+        // Junta com o vizinho da direita e depois com o da esquerda
+        if (i + 1 < partitions.size() && partitions[i + 1].free) {
+            partitions[i].size += partitions[i + 1].size;
+            partitions.erase(partitions.begin() + i + 1);
+        }
+        if (i > 0 && partitions[i - 1].free) {
+            partitions[i - 1].size += partitions[i].size;
+            partitions.erase(partitions.begin() + i);
+        }
+        return;
+    }
+}
+
+// -------------------------------------------------------------
+// Compactação: desliza os blocos ocupados para o início da RAM,
+// relocando partition_base. Cada palavra movida custa uma leitura
+// e uma escrita na memória primária, cobradas do processo movido.
+// -------------------------------------------------------------
+uint64_t MemoryManager::compact() {
+
+    if (mode != MemoryMode::VARIABLE_PARTITIONS) return 0;
+
+    std::vector<Partition> packed;
+    uint32_t cursor = 0;
+    uint64_t moved = 0;
+
+    for (auto &p : partitions) {
+        if (p.free) continue;
+
+        if (p.base != cursor) {
+            purgeRange(cursor, p.size);
+            purgeRange(p.base, p.size);
+
+            std::vector<uint32_t> block(p.size);
+            mainMemory->ReadBlock(p.base, block.data(), p.size);
+            mainMemory->WriteBlock(cursor, block.data(), p.size);
+
+            if (p.owner) {
+                uint64_t cost = 2ull * p.size * p.owner->memWeights.primary;
+                p.owner->primary_mem_accesses.fetch_add(2ull * p.size);
+                p.owner->memory_cycles.fetch_add(cost);
+                p.owner->partition_base = cursor;
+                p.owner->segment.base = cursor;
+            }
+            moved += p.size;
+            p.base = cursor;
+        }
+
+        cursor += p.size;
+        packed.push_back(p);
+    }
+
+    if (cursor < mainMemoryLimit)
+        packed.emplace_back(cursor, mainMemoryLimit - cursor);
+
+    partitions.swap(packed);
+    for (size_t i = 0; i < partitions.size(); i++)
+        if (partitions[i].owner) partitions[i].owner->partition_id = static_cast<int>(i);
+
+    // Quem usa código compartilhado acompanha o holder relocado
+    for (auto &entry : sharedCode)
+        for (PCB* s : entry.second->sharers)
+            s->textSegment.base = entry.second->holder->segment.base;
+
+    nextFitBase = 0;
+    compactions++;
+    compactedWords += moved;
+    return moved;
+}
+
+// -------------------------------------------------------------
+//                      BUDDY SYSTEM
+// -------------------------------------------------------------
+// Blocos de 2^k palavras; uma lista livre ordenada por ordem k.
+// Alocar/liberar custa O(log n) por ordem (busca no std::set) e
+// no máximo (maxOrder - minOrder) divisões ou fusões.
+static uint32_t ceilLog2(uint32_t v) {
+    uint32_t k = 0;
+    while ((1u << k) < v) k++;
+    return k;
+}
+
+void MemoryManager::createBuddy(uint32_t minBlock) {
+    mode = MemoryMode::BUDDY;
+    partitions.clear();
+
+    // Maior potência de 2 que cabe na RAM
+    buddyMaxOrder = 0;
+    while ((2u << buddyMaxOrder) <= mainMemoryLimit) buddyMaxOrder++;
+    buddyMinOrder = std::min(ceilLog2(minBlock == 0 ? 1 : minBlock), buddyMaxOrder);
+
+    buddyFree.assign(buddyMaxOrder + 1, std::set<uint32_t>());
+    buddyFree[buddyMaxOrder].insert(0);
+}
+
+bool MemoryManager::allocateBuddy(PCB &pcb, uint32_t sizeRequired) {
+
+    if (sizeRequired == 0) sizeRequired = 1;
+    uint32_t order = std::max(ceilLog2(sizeRequired), buddyMinOrder);
+    if (order > buddyMaxOrder) return false;
+
+    // NUMA: menor bloco livre que comece no nó do processo
+    uint32_t k = order;
+    uint32_t base = 0;
+    bool found = false;
+    int node = homeNode(pcb);
+
+    if (node >= 0) {
+        for (; k <= buddyMaxOrder; k++) {
+            auto it = buddyFree[k].lower_bound(numa->nodeBase(node));
+            if (it != buddyFree[k].end() && numa->nodeOf(*it) == node) {
+                base = *it;
+                buddyFree[k].erase(it);
+                found = true;
+                break;
+            }
+        }
+    }
+
+    if (!found) {
+        k = order;
+        while (k <= buddyMaxOrder && buddyFree[k].empty()) k++;
+        if (k > buddyMaxOrder) return false;
+
+        base = *buddyFree[k].begin();
+        buddyFree[k].erase(buddyFree[k].begin());
+    }
+
+    // Divide até a ordem pedida; a metade de cima volta para a lista
+    while (k > order) {
+        k--;
+        buddyFree[k].insert(base + (1u << k));
+    }
+
+    Partition p(base, 1u << order);
+    p.free = false;
+    p.pid = pcb.pid;
+    p.used = sizeRequired;
+    p.owner = &pcb;
+    partitions.push_back(p);
+
+    pcb.partition_id   = static_cast<int>(partitions.size() - 1);
+    pcb.partition_base = base;
+    pcb.partition_size = p.size;
+    pcb.segment = {base, p.size, true};
+    return true;
+}
+
+void MemoryManager::freeBuddy(int pid) {
+    for (size_t i = 0; i < partitions.size(); i++) {
+        if (partitions[i].pid != pid) continue;
+
+        uint32_t base = partitions[i].base;
+        uint32_t order = ceilLog2(partitions[i].size);
+        if (partitions[i].owner) partitions[i].owner->segment.valid = false;
+        partitions.erase(partitions.begin() + i);
+
+        // Funde com o buddy enquanto ele também estiver livre
+        while (order < buddyMaxOrder) {
+            uint32_t buddy = base ^ (1u << order);
+            auto it = buddyFree[order].find(buddy);
+            if (it == buddyFree[order].end()) break;
+
+            buddyFree[order].erase(it);
+            base = std::min(base, buddy);
+            order++;
+        }
+        buddyFree[order].insert(base);
+
+        for (size_t j = i; j < partitions.size(); j++)
+            if (partitions[j].owner) partitions[j].owner->partition_id = static_cast<int>(j);
+        return;
+    }
+}
+
+// -------------------------------------------------------------
+//                      FRAGMENTAÇÃO
+// -------------------------------------------------------------
+FragmentationStats MemoryManager::fragmentation() const {
+    FragmentationStats f;
+    uint64_t allocated = 0;
+
+    for (const auto &p : partitions) {
+        if (p.free) {
+            f.freeWords += p.size;
+            f.largestHole = std::max(f.largestHole, p.size);
+            f.holes++;
+        } else {
+            allocated += p.size;
+            f.internalWords += p.size - std::min(p.used, p.size);
         }
     }
+
+    if (mode == MemoryMode::BUDDY) {
+        for (uint32_t k = buddyMinOrder; k <= buddyMaxOrder && k < buddyFree.size(); k++) {
+            if (buddyFree[k].empty()) continue;
+            f.freeWords += static_cast<uint32_t>(buddyFree[k].size()) << k;
+            f.largestHole = 1u << k;
+            f.holes += static_cast<uint32_t>(buddyFree[k].size());
+        }
+    }
+
+    if (f.freeWords > 0)
+        f.external = 1.0 - (double)f.largestHole / f.freeWords;
+    if (allocated > 0)
+        f.internal = (double)f.internalWords / allocated;
+    return f;
+}
+
+// -------------------------------------------------------------
+//                 CRIAÇÃO DOS QUADROS (PAGINAÇÃO)
+// -------------------------------------------------------------
+void MemoryManager::createFrames(uint32_t pageSize_) {
+
+    mode = MemoryMode::PAGING;
+    pageSize = pageSize_ == 0 ? 1 : pageSize_;
+
+    frames.clear();
+    freeFrames.clear();
+
+    uint32_t offset = 0;
+    while (offset + pageSize <= mainMemoryLimit) {
+        frames.emplace_back(offset);
+        offset += pageSize;
+    }
+
+    // Pilha de livres: quadro 0 no topo
+    for (size_t i = frames.size(); i > 0; --i)
+        freeFrames.push_back(static_cast<uint32_t>(i - 1));
+
+    replacer.reset(frames.size());
+    if (tlbs.empty()) tlbs.emplace_back();
+}
+
+// -------------------------------------------------------------
+//               ALOCAÇÃO DE PÁGINAS (tudo ou nada)
+// -------------------------------------------------------------
+bool MemoryManager::allocatePages(PCB &pcb, uint32_t sizeRequired) {
+
+    uint32_t numPages = (sizeRequired + pageSize - 1) / pageSize;
+    if (numPages == 0) numPages = 1;
+
+    // Sob demanda: só reserva espaço no swap, nenhum quadro ainda
+    if (demandPaging) {
+        if (freeSwapSlots.size() + (swapSlotCount - nextSwapSlot) < numPages)
+            return false;
+
+        pcb.pageTable.assign(numPages, PageTableEntry{});
+        for (auto &pte : pcb.pageTable) {
+            if (!freeSwapSlots.empty()) {
+                pte.swapSlot = static_cast<int32_t>(freeSwapSlots.back());
+                freeSwapSlots.pop_back();
+            } else {
+                pte.swapSlot = static_cast<int32_t>(nextSwapSlot++);
+            }
+        }
+
+        pcb.partition_id   = -1;
+        pcb.partition_base = 0;
+        pcb.partition_size = numPages * pageSize;
+        pcb.segment.valid  = false;
+        return true;
+    }
+
+    if (freeFrames.size() < numPages) return false;
+
+    pcb.pageTable.assign(numPages, PageTableEntry{});
+
+    for (uint32_t vpn = 0; vpn < numPages; vpn++) {
+        uint32_t f = takeFreeFrame(pageNode(pcb, vpn));
+
+        frames[f].free = false;
+        frames[f].pid  = pcb.pid;
+        frames[f].page = vpn;
+        frames[f].owner = &pcb;
+
+        pcb.pageTable[vpn].frame = f;
+        pcb.pageTable[vpn].valid = true;
+    }
+
+    pcb.partition_id   = -1;
+    pcb.partition_base = 0;
+    pcb.partition_size = numPages * pageSize;
+    pcb.segment.valid  = false;
+    return true;
+}
+
+// -------------------------------------------------------------
+void MemoryManager::freePages(PCB &pcb) {
+
+    for (auto &pte : pcb.pageTable) {
+        if (pte.shared) continue;   // pertence ao holder do código
+        if (pte.swapSlot >= 0)
+            freeSwapSlots.push_back(static_cast<uint32_t>(pte.swapSlot));
+        if (!pte.valid) continue;
+        Frame &f = frames[pte.frame];
+        f.free = true;
+        f.pid  = -1;
+        f.owner = nullptr;
+        replacer.onFree(pte.frame);
+        freeFrames.push_back(pte.frame);
+    }
+    pcb.pageTable.clear();
+
+    for (auto &t : tlbs) t.flushPid(pcb.pid);
+}
+
+// -------------------------------------------------------------
+//                     CONFIGURAÇÃO DA TLB
+// -------------------------------------------------------------
+void MemoryManager::configureTLB(size_t numCores, size_t entries, size_t ways,
+                                 uint64_t hitCycles, uint64_t missCycles)
+{
+    tlbs.assign(numCores == 0 ? 1 : numCores, TLB(entries, ways));
+    tlbHitCycles  = hitCycles;
+    tlbMissCycles = missCycles;
+}
+
+// -------------------------------------------------------------
+//              PAGINAÇÃO SOB DEMANDA (SWAP)
+// -------------------------------------------------------------
+void MemoryManager::enableDemandPaging(PageReplacementPolicy policy,
+                                       uint64_t workingSetWindow,
+                                       uint64_t agingInterval_)
+{
+    if (mode != MemoryMode::PAGING)
+        throw std::logic_error("Demand paging requires createFrames()");
+
+    demandPaging = true;
+    agingInterval = agingInterval_ == 0 ? 1 : agingInterval_;
+
+    replacer = PageReplacer(policy, workingSetWindow);
+    replacer.reset(frames.size());
+
+    // Swap dividido em slots do tamanho da página, entregues sob
+    // demanda (um swap de gigabytes não vira uma lista de gigabytes)
+    freeSwapSlots.clear();
+    swapSlotCount = std::min<uint64_t>(secondaryMemoryLimit / pageSize, INT32_MAX);
+    nextSwapSlot = 0;
+}
+
+bool MemoryManager::useSecondaryBackingFile(const std::string &path, size_t words) {
+    secondaryMemory = std::make_unique<SECONDARY_MEMORY>(words, path);
+    secondaryMemoryLimit = secondaryMemory->getSize();
+    return secondaryMemory->isFileBacked();
+}
+
+// Página mapeada no swap mas fora da RAM (nullptr caso contrário)
+PageTableEntry* MemoryManager::swappedOutPage(uint32_t logicalAddr, PCB &pcb) {
+    if (!demandPaging) return nullptr;
+
+    uint32_t vpn = logicalAddr / pageSize;
+    if (vpn >= pcb.pageTable.size()) return nullptr;
+
+    PageTableEntry &pte = pcb.pageTable[vpn];
+    if (pte.valid || pte.swapSlot < 0) return nullptr;
+    return &pte;
+}
+
+// -------------------------------------------------------------
+// Antes de reaproveitar (ou mover) uma faixa física: linhas das
+// caches e do write buffer que apontam para ela voltam para a RAM
+// e são descartadas
+// -------------------------------------------------------------
+void MemoryManager::purgeRange(uint32_t base, uint32_t length) {
+    writeBuffer.drainAll(this);
+
+    // Victim antes da L1: a linha da L1 é sempre a mais nova
+    std::vector<std::pair<uint32_t, uint32_t>> vdirty;
+    victimCache.removeRange(base, base + length, vdirty);
+    for (auto &l : vdirty) writeToFile(l.first, l.second);
+
+    if (L1_cache) {
+        std::vector<std::pair<size_t, size_t>> dirty;
+        L1_cache->removeRange(base, base + length, dirty);
+        for (auto &l : dirty)
+            writeToFile(static_cast<uint32_t>(l.first), static_cast<uint32_t>(l.second));
+    }
+}
+
+// -------------------------------------------------------------
+// Expulsa a página de um quadro (write-back no swap se suja).
+// O custo do page-out é cobrado de quem causou a falta.
+// -------------------------------------------------------------
+void MemoryManager::evictFrame(uint32_t frame, PCB &faulting) {
+
+    Frame &fr = frames[frame];
+    purgeRange(fr.base, pageSize);
+
+    if (fr.owner) {
+        PageTableEntry &pte = fr.owner->pageTable[fr.page];
+
+        if (pte.dirty) {
+            std::vector<uint32_t> page(pageSize);
+            mainMemory->ReadBlock(fr.base, page.data(), pageSize);
+            secondaryMemory->WriteBlock(static_cast<uint32_t>(pte.swapSlot) * pageSize,
+                                        page.data(), pageSize);
+
+            uint64_t cost = pageSize * faulting.memWeights.secondary;
+            faulting.secondary_mem_accesses.fetch_add(pageSize);
+            faulting.memory_cycles.fetch_add(cost);
+            faulting.page_fault_cycles.fetch_add(cost);
+            faulting.page_fault_wait.fetch_add(cost);
+            pageOuts++;
+        }
+
+        pte.valid = false;
+        pte.referenced = false;
+        pte.dirty = false;
+
+        for (auto &t : tlbs) t.invalidate(fr.owner->pid, fr.page);
+
+        // Página de código compartilhado: sai da TLB de todos que a usam
+        auto sc = sharedCode.find(fr.owner->pid);
+        if (sc != sharedCode.end())
+            for (PCB* s : sc->second->sharers)
+                for (auto &t : tlbs) t.invalidate(s->pid, s->text_base / pageSize + fr.page);
+    }
+
+    replacer.onFree(frame);
+    fr.free = true;
+    fr.pid = -1;
+    fr.owner = nullptr;
+}
+
+// Quadro livre, de preferência no nó pedido (-1 = o do topo da pilha)
+uint32_t MemoryManager::takeFreeFrame(int node) {
+    size_t pick = freeFrames.size() - 1;
+
+    if (node >= 0) {
+        for (size_t i = freeFrames.size(); i > 0; --i) {
+            if (numa->nodeOf(frames[freeFrames[i - 1]].base) == node) {
+                pick = i - 1;
+                break;
+            }
+        }
+    }
+
+    uint32_t f = freeFrames[pick];
+    freeFrames[pick] = freeFrames.back();
+    freeFrames.pop_back();
+    return f;
+}
+
+// -------------------------------------------------------------
+// Quadro para uma página nova: livre ou vítima da política
+// (o page-out da vítima é cobrado de quem pediu)
+// -------------------------------------------------------------
+uint32_t MemoryManager::acquireFrame(PCB &charged, int node) {
+
+    if (frames.empty())
+        throw std::runtime_error("No frames available");
+
+    uint32_t f;
+    if (!freeFrames.empty()) {
+        f = takeFreeFrame(node);
+    } else {
+        if (!demandPaging)
+            throw std::runtime_error("No frames available");
+        f = replacer.selectVictim(frames, currentTick);
+        evictFrame(f, charged);
+    }
+
+    purgeRange(frames[f].base, pageSize);
+    return f;
+}
+
+// -------------------------------------------------------------
+// Falta de página: escolhe quadro (livre ou vítima), carrega a
+// página do swap e agenda o bloqueio do processo (page_fault_wait).
+// owner é o dono da tabela (o holder, para código compartilhado);
+// charged é o processo que faltou.
+// -------------------------------------------------------------
+void MemoryManager::servicePageFault(PCB &owner, uint32_t vpn, PCB &charged) {
+
+    uint32_t f = acquireFrame(charged, pageNode(owner, vpn));
+
+    PageTableEntry &pte = owner.pageTable[vpn];
+    std::vector<uint32_t> page(pageSize);
+    secondaryMemory->ReadBlock(static_cast<uint32_t>(pte.swapSlot) * pageSize,
+                               page.data(), pageSize);
+    mainMemory->WriteBlock(frames[f].base, page.data(), pageSize);
+
+    uint64_t cost = pageSize * charged.memWeights.secondary;
+    charged.secondary_mem_accesses.fetch_add(pageSize);
+    charged.memory_cycles.fetch_add(cost);
+    charged.page_fault_cycles.fetch_add(cost);
+    charged.page_fault_wait.fetch_add(cost);
+    charged.page_faults.fetch_add(1);
+    pageIns++;
+
+    Frame &fr = frames[f];
+    fr.free = false;
+    fr.pid = owner.pid;
+    fr.page = vpn;
+    fr.owner = &owner;
+
+    pte.frame = f;
+    pte.valid = true;
+    pte.referenced = true;
+    pte.dirty = false;
+    pte.lastUse = currentTick;
+
+    replacer.onLoad(f);
+}
+
+// -------------------------------------------------------------
+//          FILA DE ESPERA POR PÁGINA (como um dispositivo)
+// -------------------------------------------------------------
+void MemoryManager::blockOnPageFault(PCB* pcb) {
+    pcb->state = State::Blocked;
+    pageWaiters.push_back(pcb);
+}
+
+std::vector<PCB*> MemoryManager::takePageReady() {
+    std::vector<PCB*> out;
+    out.swap(pageReady);
+    return out;
+}
+
+// -------------------------------------------------------------
+//                    NUMA: POSICIONAMENTO
+// -------------------------------------------------------------
+void MemoryManager::enableNuma(size_t nodes, NumaPlacement placement,
+                               uint64_t localCycles, uint64_t remoteCycles) {
+    numa = std::make_unique<NumaTopology>(nodes, mainMemoryLimit, placement,
+                                          localCycles, remoteCycles);
+    nextInterleaveNode = 0;
+}
+
+// Palavras livres no nó (blocos contados pelo nó da base)
+uint64_t MemoryManager::freeWordsOnNode(int node) const {
+    uint64_t words = 0;
+
+    if (mode == MemoryMode::PAGING) {
+        for (uint32_t f : freeFrames)
+            if (numa->nodeOf(frames[f].base) == node) words += pageSize;
+    } else if (mode == MemoryMode::BUDDY) {
+        for (uint32_t k = 0; k < buddyFree.size(); k++)
+            for (uint32_t base : buddyFree[k])
+                if (numa->nodeOf(base) == node) words += 1ull << k;
+    } else {
+        for (const auto &p : partitions)
+            if (p.free && numa->nodeOf(p.base) == node) words += p.size;
+    }
+    return words;
+}
+
+// Nó do processo (-1 sem NUMA). Escolhido na primeira alocação:
+// intercalado gira entre os nós; first-touch usa o nó do core
+// corrente ou, na carga, o nó com mais memória livre.
+int MemoryManager::homeNode(PCB &pcb) {
+    if (!numa) return -1;
+    if (pcb.numa_home >= 0) return pcb.numa_home;
+
+    int node = 0;
+    if (numa->getPlacement() == NumaPlacement::INTERLEAVED) {
+        node = static_cast<int>(nextInterleaveNode++ % numa->numNodes());
+    } else if (numa->nodeOfCore(currentCore) >= 0) {
+        node = numa->nodeOfCore(currentCore);
+    } else {
+        uint64_t best = 0;
+        for (size_t n = 0; n < numa->numNodes(); n++) {
+            uint64_t free = freeWordsOnNode(static_cast<int>(n));
+            if (free > best) {
+                best = free;
+                node = static_cast<int>(n);
+            }
+        }
+    }
+
+    pcb.numa_home = node;
+    return node;
+}
+
+// Nó de uma página: alternado a partir do nó do processo, ou o
+// nó de quem toca primeiro (core da falta; na carga, o do processo)
+int MemoryManager::pageNode(PCB &pcb, uint32_t vpn) {
+    if (!numa) return -1;
+
+    int home = homeNode(pcb);
+    if (numa->getPlacement() == NumaPlacement::INTERLEAVED)
+        return static_cast<int>((home + vpn) % numa->numNodes());
+
+    int coreNode = numa->nodeOfCore(currentCore);
+    return coreNode >= 0 ? coreNode : home;
+}
+
+// Latência extra do acesso (core corrente → nó do endereço)
+uint64_t MemoryManager::numaCycles(uint32_t address) const {
+    if (!numa) return 0;
+    int from = numa->nodeOfCore(currentCore);
+    if (from < 0) return 0;
+    return numa->latency(from, numa->nodeOf(address));
+}
+
+void MemoryManager::chargeNuma(uint32_t address, PCB &process) {
+    if (!numa) return;
+    int from = numa->nodeOfCore(currentCore);
+    if (from < 0) return;
+
+    int to = numa->nodeOf(address);
+    if (from == to) process.numa_local_accesses.fetch_add(1);
+    else            process.numa_remote_accesses.fetch_add(1);
+    process.memory_cycles.fetch_add(numa->latency(from, to));
 }
 
 // -------------------------------------------------------------
-//         ENDEREÇO LÓGICO → FÍSICO (partições)
+//              ALOCAÇÃO CONFORME O MODO DE MEMÓRIA
+// -------------------------------------------------------------
+bool MemoryManager::allocateProcess(PCB &pcb, uint32_t sizeRequired) {
+    switch (mode) {
+        case MemoryMode::PAGING:
+            return allocatePages(pcb, sizeRequired);
+        case MemoryMode::VARIABLE_PARTITIONS:
+            return allocateVariablePartition(pcb, sizeRequired) != nullptr;
+        case MemoryMode::BUDDY:
+            return allocateBuddy(pcb, sizeRequired);
+        case MemoryMode::FIXED_PARTITIONS:
+        default:
+            return allocateFixedPartition(pcb, sizeRequired) != nullptr;
+    }
+}
+
+void MemoryManager::freeProcess(PCB &pcb) {
+    switch (mode) {
+        case MemoryMode::PAGING:              freePages(pcb); break;
+        case MemoryMode::VARIABLE_PARTITIONS: freeVariablePartition(pcb.pid); break;
+        case MemoryMode::BUDDY:               freeBuddy(pcb.pid); break;
+        case MemoryMode::FIXED_PARTITIONS:
+        default:                              freePartition(pcb.pid); break;
+    }
+    releaseSharedCode(pcb);
+}
+
+// -------------------------------------------------------------
+//               CÓDIGO COMPARTILHADO (loadProgram)
+// -------------------------------------------------------------
+// FNV-1a de 64 bits sobre as palavras do CODE
+static uint64_t hashCode(const std::vector<uint32_t> &code) {
+    uint64_t h = 1469598103934665603ull;
+    for (uint32_t w : code) {
+        for (int b = 0; b < 4; b++) {
+            h ^= (w >> (8 * b)) & 0xFF;
+            h *= 1099511628211ull;
+        }
+    }
+    return h;
+}
+
+bool MemoryManager::loadProgram(PCB &pcb) {
+    const std::vector<uint32_t> &code = pcb.codeSegment;
+
+    // Paginação: o CODE precisa começar numa fronteira de página para
+    // as páginas inteiras serem compartilhadas; senão fica privado
+    bool share = sharedCodeEnabled && !code.empty()
+                 && (mode != MemoryMode::PAGING || pcb.data_bytes % pageSize == 0);
+
+    if (!share) {
+        uint32_t req = pcb.data_bytes + static_cast<uint32_t>(code.size());
+        if (req == 0) req = 1;   // reservar ao menos 1 palavra
+        if (!allocateProcess(pcb, req)) return false;
+
+        loadSegment(pcb, pcb.dataSegment, 0);
+        loadSegment(pcb, code, pcb.data_bytes);   // CODE após DATA
+        pcb.initial_pc = pcb.data_bytes;
+        return true;
+    }
+
+    bool created = false;
+    SharedCode* sc = acquireSharedCode(pcb, created);
+    if (!sc) return false;
+
+    if (!mapSharedCode(pcb, *sc)) {
+        // Cópia recém-criada sem nenhum usuário: devolve o espaço
+        if (sc->sharers.empty()) dropSharedCode(sc->holder->pid);
+        return false;
+    }
+
+    if (!created) {
+        sharedReuses++;
+        sharedWordsSaved += code.size();
+    }
+
+    loadSegment(pcb, pcb.dataSegment, 0);
+    pcb.initial_pc = pcb.data_bytes;
+    return true;
+}
+
+// Cópia existente com o mesmo conteúdo, ou uma nova (alocada e
+// carregada aqui). nullptr se não houver espaço para o CODE.
+SharedCode* MemoryManager::acquireSharedCode(PCB &pcb, bool &created) {
+    const std::vector<uint32_t> &code = pcb.codeSegment;
+    uint64_t h = hashCode(code);
+
+    auto range = sharedByHash.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        SharedCode* sc = sharedCode[it->second].get();
+        if (sc->words == code) return sc;
+    }
+
+    auto sc = std::make_unique<SharedCode>();
+    sc->hash = h;
+    sc->words = code;
+    sc->holder = std::make_unique<PCB>();
+    sc->holder->pid = nextSharedId;
+    sc->holder->name = "text:" + pcb.name;
+
+    if (!allocateProcess(*sc->holder, static_cast<uint32_t>(code.size())))
+        return nullptr;
+
+    loadSegment(*sc->holder, code, 0);
+    pcb.load_cycles.fetch_add(sc->holder->load_cycles.exchange(0));
+
+    SharedCode* out = sc.get();
+    sharedByHash.emplace(h, nextSharedId);
+    sharedCode[nextSharedId] = std::move(sc);
+    nextSharedId--;
+    created = true;
+    return out;
+}
+
+// Espaço privado (só DATA) + mapeamento do CODE do holder
+bool MemoryManager::mapSharedCode(PCB &pcb, SharedCode &sc) {
+    PCB &holder = *sc.holder;
+
+    if (mode == MemoryMode::PAGING) {
+        if (pcb.data_bytes > 0) {
+            if (!allocatePages(pcb, pcb.data_bytes)) return false;
+        } else {
+            pcb.pageTable.clear();
+            pcb.partition_id   = -1;
+            pcb.partition_base = 0;
+            pcb.segment.valid  = false;
+        }
+
+        // Entradas do CODE apontam para a tabela do holder
+        PageTableEntry alias;
+        alias.shared = true;
+        pcb.pageTable.insert(pcb.pageTable.end(), holder.pageTable.size(), alias);
+        pcb.partition_size = static_cast<uint32_t>(pcb.pageTable.size()) * pageSize;
+    } else {
+        if (pcb.data_bytes > 0) {
+            if (!allocateProcess(pcb, pcb.data_bytes)) return false;
+        } else {
+            pcb.partition_id   = -1;
+            pcb.partition_base = 0;
+            pcb.partition_size = 0;
+            pcb.segment = {0, 0, true};
+        }
+        pcb.textSegment = {holder.segment.base,
+                           static_cast<uint32_t>(sc.words.size()), true};
+    }
+
+    pcb.shared_text = holder.pid;
+    pcb.text_base = pcb.data_bytes;
+    sc.sharers.push_back(&pcb);
+    return true;
+}
+
+// Solta a referência; o último processo libera a cópia física
+void MemoryManager::releaseSharedCode(PCB &pcb) {
+    if (pcb.shared_text == -1) return;
+
+    auto it = sharedCode.find(pcb.shared_text);
+    pcb.shared_text = -1;
+    pcb.textSegment.valid = false;
+    if (it == sharedCode.end()) return;
+
+    SharedCode &sc = *it->second;
+    sc.sharers.erase(std::remove(sc.sharers.begin(), sc.sharers.end(), &pcb),
+                     sc.sharers.end());
+    if (sc.sharers.empty()) dropSharedCode(it->first);
+}
+
+void MemoryManager::dropSharedCode(int id) {
+    auto it = sharedCode.find(id);
+    if (it == sharedCode.end()) return;
+
+    freeProcess(*it->second->holder);
+    auto range = sharedByHash.equal_range(it->second->hash);
+    for (auto h = range.first; h != range.second; ++h)
+        if (h->second == id) { sharedByHash.erase(h); break; }
+    sharedCode.erase(it);
+}
+
+// -------------------------------------------------------------
+// Copy-on-write: a página de código vira uma cópia privada do
+// processo (quadro próprio e, sob demanda, slot próprio no swap)
+// -------------------------------------------------------------
+void MemoryManager::copyOnWritePage(PCB &pcb, uint32_t vpn) {
+    if (!copyOnWrite)
+        throw std::runtime_error("Write to shared code segment");
+
+    PCB* owner;
+    uint32_t ownerVpn;
+    const PageTableEntry &src = effectivePTE(pcb, vpn, owner, ownerVpn);
+
+    // Conteúdo atual (o código nunca fica sujo na cache)
+    std::vector<uint32_t> page(pageSize);
+    if (src.valid)
+        mainMemory->ReadBlock(frames[src.frame].base, page.data(), pageSize);
+    else
+        secondaryMemory->ReadBlock(static_cast<uint32_t>(src.swapSlot) * pageSize,
+                                   page.data(), pageSize);
+
+    int32_t slot = -1;
+    if (demandPaging) {
+        if (!freeSwapSlots.empty()) {
+            slot = static_cast<int32_t>(freeSwapSlots.back());
+            freeSwapSlots.pop_back();
+        } else if (nextSwapSlot < swapSlotCount) {
+            slot = static_cast<int32_t>(nextSwapSlot++);
+        } else {
+            throw std::runtime_error("Swap full");
+        }
+    }
+
+    uint32_t f = acquireFrame(pcb, pageNode(pcb, vpn));
+    mainMemory->WriteBlock(frames[f].base, page.data(), pageSize);
+
+    Frame &fr = frames[f];
+    fr.free = false;
+    fr.pid = pcb.pid;
+    fr.page = vpn;
+    fr.owner = &pcb;
+
+    PageTableEntry &pte = pcb.pageTable[vpn];
+    pte = PageTableEntry{};
+    pte.frame = f;
+    pte.valid = true;
+    pte.referenced = true;
+    pte.dirty = true;
+    pte.swapSlot = slot;
+    pte.lastUse = currentTick;
+
+    replacer.onLoad(f);
+    for (auto &t : tlbs) t.invalidate(pcb.pid, vpn);
+
+    uint64_t cost = 2ull * pageSize * pcb.memWeights.primary;
+    pcb.primary_mem_accesses.fetch_add(2ull * pageSize);
+    pcb.memory_cycles.fetch_add(cost);
+    cowCopies++;
+}
+
+double MemoryManager::usagePercent() const {
+    if (mode == MemoryMode::PAGING) {
+        if (frames.empty()) return 0.0;
+        return (double)(frames.size() - freeFrames.size()) / frames.size() * 100.0;
+    }
+
+    // Variável / buddy: palavras alocadas sobre a RAM gerenciada
+    if (mode == MemoryMode::VARIABLE_PARTITIONS || mode == MemoryMode::BUDDY) {
+        uint64_t allocated = 0;
+        for (const auto &p : partitions)
+            if (!p.free) allocated += p.size;
+        uint64_t total = mode == MemoryMode::BUDDY ? (1ull << buddyMaxOrder) : mainMemoryLimit;
+        return total > 0 ? (double)allocated / total * 100.0 : 0.0;
+    }
+
+    if (partitions.empty()) return 0.0;
+    size_t occupied = 0;
+    for (const auto &p : partitions)
+        if (!p.free) occupied++;
+    return (double)occupied / partitions.size() * 100.0;
+}
+
+// -------------------------------------------------------------
+//         ENDEREÇO LÓGICO → FÍSICO (partições ou páginas)
 // -------------------------------------------------------------
 uint32_t MemoryManager::resolveAddress(uint32_t logicalAddr, const PCB &pcb) {
 
+    if (mode == MemoryMode::PAGING) {
+        uint32_t vpn = logicalAddr / pageSize;
+        if (vpn >= pcb.pageTable.size())
+            throw std::out_of_range("Logical Addr > Address Space");
+
+        const PageTableEntry* pte = &pcb.pageTable[vpn];
+        if (pte->shared)
+            pte = &sharedCode.at(pcb.shared_text)->holder->pageTable[vpn - pcb.text_base / pageSize];
+        if (!pte->valid)
+            throw std::runtime_error("Page not present");
+
+        return frames[pte->frame].base + logicalAddr % pageSize;
+    }
+
+    // Código compartilhado: segmento do holder
+    if (pcb.textSegment.valid && logicalAddr >= pcb.text_base) {
+        if (logicalAddr - pcb.text_base >= pcb.textSegment.limit)
+            throw std::out_of_range("Logical Addr > Code Segment");
+        return pcb.textSegment.base + (logicalAddr - pcb.text_base);
+    }
+
+    // Caminho rápido: descritor de segmento no PCB (O(1))
+    if (pcb.segment.valid) {
+        if (logicalAddr >= pcb.segment.limit)
+            throw std::out_of_range("Logical Addr > Partition Size");
+        return pcb.segment.base + logicalAddr;
+    }
+
+    // PCB sem descritor (ex.: partição atribuída por fora do alocador)
     for (const auto &p : partitions) {
         if (p.pid == pcb.pid) {
 
@@ -80,12 +1096,98 @@ uint32_t MemoryManager::resolveAddress(uint32_t logicalAddr, const PCB &pcb) {
     throw std::runtime_error("Process does not own a partition");
 }
 
+// -------------------------------------------------------------
+//     TRADUÇÃO COM TLB (cobra ciclos e conta faltas no PCB)
+// -------------------------------------------------------------
+uint32_t MemoryManager::translate(uint32_t logicalAddr, PCB &pcb, bool isWrite) {
+
+    if (mode != MemoryMode::PAGING) {
+        if (isWrite && pcb.textSegment.valid && logicalAddr >= pcb.text_base)
+            throw std::runtime_error("Write to shared code segment");
+        return resolveAddress(logicalAddr, pcb);
+    }
+
+    uint32_t vpn = logicalAddr / pageSize;
+    uint32_t offset = logicalAddr % pageSize;
+
+    // Escrita em página de código compartilhado: cópia privada ou erro
+    if (isWrite && vpn < pcb.pageTable.size() && pcb.pageTable[vpn].shared)
+        copyOnWritePage(pcb, vpn);
+
+    // Fora de um core (carga de programa): sem TLB, sem custo
+    bool useTLB = currentCore >= 0 && static_cast<size_t>(currentCore) < tlbs.size();
+
+    uint32_t frame;
+    if (useTLB && tlbs[currentCore].lookup(pcb.pid, vpn, frame)) {
+        pcb.tlb_hits.fetch_add(1);
+        pcb.memory_cycles.fetch_add(tlbHitCycles);
+    } else {
+        if (useTLB) {
+            pcb.tlb_misses.fetch_add(1);
+            pcb.memory_cycles.fetch_add(tlbMissCycles);
+        }
+
+        if (vpn >= pcb.pageTable.size()) {
+            pcb.page_faults.fetch_add(1);
+            throw std::out_of_range("Logical Addr > Address Space");
+        }
+
+        PCB* owner;
+        uint32_t ownerVpn;
+        PageTableEntry &entry = effectivePTE(pcb, vpn, owner, ownerVpn);
+
+        if (!entry.valid) {
+            if (!demandPaging || entry.swapSlot < 0) {
+                pcb.page_faults.fetch_add(1);
+                throw std::runtime_error("Page not present");
+            }
+            servicePageFault(*owner, ownerVpn, pcb);
+        }
+
+        frame = entry.frame;
+        if (useTLB) tlbs[currentCore].insert(pcb.pid, vpn, frame);
+    }
+
+    PCB* owner;
+    uint32_t ownerVpn;
+    PageTableEntry &pte = effectivePTE(pcb, vpn, owner, ownerVpn);
+    pte.referenced = true;
+    pte.lastUse = currentTick;
+    if (isWrite) pte.dirty = true;
+
+    return frames[frame].base + offset;
+}
+
+// Entrada efetiva da página: a do holder para código compartilhado
+PageTableEntry& MemoryManager::effectivePTE(PCB &pcb, uint32_t vpn,
+                                            PCB *&owner, uint32_t &ownerVpn) {
+    owner = &pcb;
+    ownerVpn = vpn;
+
+    PageTableEntry &pte = pcb.pageTable[vpn];
+    if (!pte.shared) return pte;
+
+    owner = sharedCode.at(pcb.shared_text)->holder.get();
+    ownerVpn = vpn - pcb.text_base / pageSize;
+    return owner->pageTable[ownerVpn];
+}
+
 // -------------------------------------------------------------
 //                   LEITURA LÓGICA
 // -------------------------------------------------------------
-uint32_t MemoryManager::readLogical(uint32_t logicalAddr, PCB &pcb) {
-    uint32_t phys = resolveAddress(logicalAddr, pcb);
-    return read(phys, pcb);
+uint32_t MemoryManager::readLogical(uint32_t logicalAddr, PCB &pcb, bool isInstruction) {
+    // Fora de um core (carga do programa): página ainda no swap
+    // é lida de lá mesmo, sem falta
+    if (currentCore < 0) {
+        if (PageTableEntry* pte = swappedOutPage(logicalAddr, pcb)) {
+            pcb.secondary_mem_accesses.fetch_add(1);
+            return secondaryMemory->ReadMem(
+                static_cast<uint32_t>(pte->swapSlot) * pageSize + logicalAddr % pageSize);
+        }
+    }
+
+    uint32_t phys = translate(logicalAddr, pcb, false);
+    return read(phys, pcb, isInstruction);
 }
 
 // -------------------------------------------------------------
@@ -95,23 +1197,96 @@ void MemoryManager::writeLogical(uint32_t logicalAddr,
                                  uint32_t data,
                                  PCB &pcb)
 {
-    uint32_t phys = resolveAddress(logicalAddr, pcb);
+    if (currentCore < 0) {
+        if (PageTableEntry* pte = swappedOutPage(logicalAddr, pcb)) {
+            pcb.secondary_mem_accesses.fetch_add(1);
+            secondaryMemory->WriteMem(
+                static_cast<uint32_t>(pte->swapSlot) * pageSize + logicalAddr % pageSize, data);
+            return;
+        }
+    }
+
+    uint32_t phys = translate(logicalAddr, pcb, true);
     write(phys, data, pcb);
 }
 
+// -------------------------------------------------------------
+//                 CARGA EM BLOCO (DMA)
+// -------------------------------------------------------------
+void MemoryManager::loadSegment(PCB &pcb, const uint32_t* words, size_t count,
+                                uint32_t logicalOffset)
+{
+    if (count == 0) return;
+
+    if (mode == MemoryMode::PAGING) {
+        // Um memcpy por página (quadro na RAM ou slot no swap)
+        size_t done = 0;
+        while (done < count) {
+            uint32_t la = logicalOffset + static_cast<uint32_t>(done);
+            uint32_t vpn = la / pageSize;
+            uint32_t off = la % pageSize;
+            if (vpn >= pcb.pageTable.size())
+                throw std::out_of_range("Segment > Address Space");
+
+            size_t chunk = std::min<size_t>(count - done, pageSize - off);
+            PageTableEntry &pte = pcb.pageTable[vpn];
+
+            if (pte.valid) {
+                uint32_t phys = frames[pte.frame].base + off;
+                purgeRange(phys, static_cast<uint32_t>(chunk));
+                if (!mainMemory->WriteBlock(phys, words + done, chunk))
+                    throw std::out_of_range("DMA outside main memory");
+            } else if (pte.swapSlot >= 0) {
+                uint32_t swapAddr = static_cast<uint32_t>(pte.swapSlot) * pageSize + off;
+                if (!secondaryMemory->WriteBlock(swapAddr, words + done, chunk))
+                    throw std::out_of_range("DMA outside secondary memory");
+            } else {
+                throw std::runtime_error("Page not present");
+            }
+            done += chunk;
+        }
+    } else {
+        if (!pcb.segment.valid)
+            throw std::runtime_error("Process does not own a partition");
+        if (logicalOffset > pcb.segment.limit || count > pcb.segment.limit - logicalOffset)
+            throw std::out_of_range("Segment > Partition Size");
+
+        uint32_t phys = pcb.segment.base + logicalOffset;
+        purgeRange(phys, static_cast<uint32_t>(count));
+        if (!mainMemory->WriteBlock(phys, words, count))
+            throw std::out_of_range("DMA outside main memory");
+    }
+
+    if (dmaWordsPerCycle > 0) {
+        uint64_t cost = dmaSetupCycles + (count + dmaWordsPerCycle - 1) / dmaWordsPerCycle;
+        pcb.load_cycles.fetch_add(cost);
+        dmaCycles += cost;
+    }
+}
+
 // -------------------------------------------------------------
 //                     LEITURA FÍSICA
 // -------------------------------------------------------------
-uint32_t MemoryManager::read(uint32_t address, PCB& process) {
+uint32_t MemoryManager::read(uint32_t address, PCB& process, bool isInstruction) {
 
     process.mem_accesses_total.fetch_add(1);
     process.mem_reads.fetch_add(1);
 
+    if (stackProfiler) stackProfiler->access(address);
+    traceAccess(address, process, false, isInstruction);
+
     // Se não houver cache configurada, ler diretamente da memória
     if (!L1_cache) {
+        uint32_t pending;
+        if (writeBuffer.lookup(address, pending)) {
+            process.memory_cycles.fetch_add(cacheCycles(process));
+            return pending;
+        }
         if (address < mainMemoryLimit) {
             process.primary_mem_accesses.fetch_add(1);
             process.memory_cycles.fetch_add(process.memWeights.primary);
+            chargeBus(address, process);
+            chargeNuma(address, process);
             return mainMemory->ReadMem(address);
         } else {
             process.secondary_mem_accesses.fetch_add(1);
@@ -123,23 +1298,40 @@ uint32_t MemoryManager::read(uint32_t address, PCB& process) {
 
     // Tenta pegar da cache
     size_t cache_data = L1_cache->get(address);
-    if (cache_data != CACHE_MISS) {
+    bool hit = (cache_data != CACHE_MISS);
+    recordCacheAccess(process, address, hit);
 
+    if (hit) {
         process.cache_mem_accesses.fetch_add(1);
-        process.memory_cycles.fetch_add(process.memWeights.cache);
-
-        contabiliza_cache(process, true);
+        process.memory_cycles.fetch_add(cacheCycles(process));
         return static_cast<uint32_t>(cache_data);
     }
 
-    contabiliza_cache(process, false);
+    // MISS na L1 → victim cache (swap de volta para a L1)
+    uint32_t data_from_mem;
+    bool victimDirty = false;
+
+    if (victimCache.enabled() && victimCache.take(address, data_from_mem, victimDirty)) {
+        process.victim_hits.fetch_add(1);
+        process.cache_mem_accesses.fetch_add(1);
+        process.memory_cycles.fetch_add(cacheCycles(process));
+
+        L1_cache->put(address, data_from_mem, this, victimDirty);
+        chargePendingWrites(process);
+        return data_from_mem;
+    }
 
     // MISS → ler RAM ou secundária
-    uint32_t data_from_mem;
 
-    if (address < mainMemoryLimit) {
+    if (writeBuffer.lookup(address, data_from_mem)) {
+        // Valor ainda no write buffer (store → load forwarding)
+        process.cache_mem_accesses.fetch_add(1);
+        process.memory_cycles.fetch_add(cacheCycles(process));
+    } else if (address < mainMemoryLimit) {
         process.primary_mem_accesses.fetch_add(1);
         process.memory_cycles.fetch_add(process.memWeights.primary);
+        chargeBus(address, process);
+        chargeNuma(address, process);
 
         data_from_mem = mainMemory->ReadMem(address);
     } else {
@@ -150,8 +1342,9 @@ uint32_t MemoryManager::read(uint32_t address, PCB& process) {
         data_from_mem = secondaryMemory->ReadMem(secAddr);
     }
 
-    // Coloca em cache (write-allocate on read miss)
+    // Coloca em cache (allocate on read miss)
     L1_cache->put(address, data_from_mem, this);
+    chargePendingWrites(process);
 
     return data_from_mem;
 }
@@ -159,39 +1352,243 @@ uint32_t MemoryManager::read(uint32_t address, PCB& process) {
 // -------------------------------------------------------------
 //                   ESCRITA FÍSICA
 // -------------------------------------------------------------
+// WRITE_THROUGH: hit atualiza a linha (limpa), miss não aloca; o valor
+//                segue para o write buffer (ou direto para a memória).
+// WRITE_BACK:    hit marca a linha suja, miss aloca a linha suja; a
+//                memória só é escrita quando a vítima sai da cache.
 void MemoryManager::write(uint32_t address, uint32_t data, PCB& process) {
 
     process.mem_accesses_total.fetch_add(1);
     process.mem_writes.fetch_add(1);
 
-    // 1) Escreve imediatamente na memória principal/secundária (write-through)
-    writeToFile(address, data);
+    if (stackProfiler) stackProfiler->access(address);
+    traceAccess(address, process, true, false);
 
-    // 2) Agora atualiza a cache (se houver)
+    // Sem cache: toda escrita vai para o buffer / memória
     if (!L1_cache) {
-        // Sem cache: contadores de memória já atualizados por writeToFile
-        process.memory_cycles.fetch_add(process.memWeights.primary); // aproximação
+        bufferedWrite(address, data);
+        chargePendingWrites(process);
         return;
     }
 
     // Verifica se a linha está na cache
     size_t cache_data = L1_cache->get(address);
+    bool hit = (cache_data != CACHE_MISS);
+    recordCacheAccess(process, address, hit);
+
+    process.cache_mem_accesses.fetch_add(1);
+    process.memory_cycles.fetch_add(cacheCycles(process));
 
-    if (cache_data == CACHE_MISS) {
-        // MISS: contabiliza miss e aloca/insere a linha com o novo valor
-        contabiliza_cache(process, false);
-        // Inserir o novo dado na cache (write-allocate)
-        L1_cache->put(address, data, this);
+    if (writePolicy == WritePolicy::WRITE_BACK) {
+        if (hit) {
+            L1_cache->update(address, data, true);
+        } else {
+            // write-allocate (linha antiga na victim cache é descartada)
+            uint32_t old; bool oldDirty;
+            if (victimCache.enabled() && victimCache.take(address, old, oldDirty))
+                process.victim_hits.fetch_add(1);
+            L1_cache->put(address, data, this, true);
+        }
     } else {
-        // HIT: contabiliza hit e atualiza a entrada
-        contabiliza_cache(process, true);
-        L1_cache->update(address, data);
+        if (hit) L1_cache->update(address, data, false);     // no-write-allocate
+        else     victimCache.update(address, data);          // mantém a vítima coerente
+        bufferedWrite(address, data);
     }
 
-    // estatísticas de cache/memória
-    process.cache_mem_accesses.fetch_add(1);
-    // já contabilizamos cycles pela memória (writeToFile), ajustar ciclos de cache também
-    process.memory_cycles.fetch_add(process.memWeights.cache);
+    chargePendingWrites(process);
+}
+
+// -------------------------------------------------------------
+//        ESCRITA VIA WRITE BUFFER (ou síncrona sem buffer)
+// -------------------------------------------------------------
+void MemoryManager::bufferedWrite(uint32_t address, uint32_t data) {
+
+    if (writeBuffer.enabled()) {
+        if (writeBuffer.push(address, data)) return;
+
+        // Buffer cheio → drena a mais antiga agora (stall)
+        writeBuffer.recordStall();
+        writeBuffer.drainOne(this);
+        pendingPrimaryWrites++;
+        pendingBusCycles += lastDrainBusCycles;
+        writeBuffer.push(address, data);
+        return;
+    }
+
+    writeToFile(address, data);
+    if (address < mainMemoryLimit) {
+        pendingPrimaryWrites++;
+        if (bus) pendingBusCycles += bus->access(address, currentCore, currentTick).total();
+        pendingBusCycles += numaCycles(address);
+    } else {
+        pendingSecondaryWrites++;
+    }
+}
+
+// -------------------------------------------------------------
+// Escrita drenada do write buffer: ocupa o barramento mesmo sem
+// processo para cobrar (quem espera é o próximo acesso)
+// -------------------------------------------------------------
+void MemoryManager::drainWrite(uint32_t address, uint32_t data) {
+    lastDrainBusCycles = 0;
+    if (bus && address < mainMemoryLimit)
+        lastDrainBusCycles = bus->access(address, currentCore, currentTick).total();
+    writeToFile(address, data);
+}
+
+// -------------------------------------------------------------
+//       WRITE-BACK DE VÍTIMA SUJA (chamado pela Cache)
+// -------------------------------------------------------------
+void MemoryManager::writeBack(uint32_t address, uint32_t data) {
+    bufferedWrite(address, data);
+}
+
+// -------------------------------------------------------------
+//       LINHA EXPULSA DA L1 (chamado pela Cache)
+// -------------------------------------------------------------
+void MemoryManager::evictFromL1(uint32_t address, uint32_t data, bool dirty) {
+
+    if (heatmap) heatmap->eviction(address, currentTick);
+
+    if (victimCache.enabled()) {
+        victimCache.insert(address, data, dirty, this);
+        return;
+    }
+
+    if (dirty) writeBack(address, data);
+}
+
+// -------------------------------------------------------------
+//         HIT/MISS DA L1 + CLASSIFICAÇÃO 3C
+// -------------------------------------------------------------
+void MemoryManager::recordCacheAccess(PCB &process, uint32_t address, bool hit) {
+
+    contabiliza_cache(process, hit);
+
+    if (heatmap) heatmap->access(address, heatRegion(address), hit, currentTick);
+
+    if (!classifyMisses) return;
+
+    switch (missClassifier.access(address, hit)) {
+        case MissType::COMPULSORY: process.miss_compulsory.fetch_add(1); break;
+        case MissType::CAPACITY:   process.miss_capacity.fetch_add(1);   break;
+        case MissType::CONFLICT:   process.miss_conflict.fetch_add(1);   break;
+        case MissType::NONE:       break;
+    }
+}
+
+// Partição física do endereço (quadro, na paginação); -1 fora delas.
+// Pelo endereço e não pelo PCB: com código compartilhado o processo
+// não tem partição própria para o CODE.
+int MemoryManager::heatRegion(uint32_t address) const {
+    if (mode == MemoryMode::PAGING) {
+        uint32_t f = pageSize ? address / pageSize : 0;
+        return f < frames.size() ? static_cast<int>(f) : -1;
+    }
+    for (size_t i = 0; i < partitions.size(); i++)
+        if (address >= partitions[i].base && address - partitions[i].base < partitions[i].size)
+            return static_cast<int>(i);
+    return -1;
+}
+
+// -------------------------------------------------------------
+//         COBRA ESCRITAS SÍNCRONAS DO PROCESSO CORRENTE
+// -------------------------------------------------------------
+void MemoryManager::chargePendingWrites(PCB &process) {
+
+    if (pendingPrimaryWrites) {
+        process.primary_mem_accesses.fetch_add(pendingPrimaryWrites);
+        process.memory_cycles.fetch_add(pendingPrimaryWrites * process.memWeights.primary);
+        process.write_stall_cycles.fetch_add(pendingPrimaryWrites * process.memWeights.primary);
+        pendingPrimaryWrites = 0;
+    }
+    if (pendingSecondaryWrites) {
+        process.secondary_mem_accesses.fetch_add(pendingSecondaryWrites);
+        process.memory_cycles.fetch_add(pendingSecondaryWrites * process.memWeights.secondary);
+        process.write_stall_cycles.fetch_add(pendingSecondaryWrites * process.memWeights.secondary);
+        pendingSecondaryWrites = 0;
+    }
+    if (pendingBusCycles) {
+        process.memory_cycles.fetch_add(pendingBusCycles);
+        process.write_stall_cycles.fetch_add(pendingBusCycles);
+        process.bus_wait_cycles.fetch_add(pendingBusCycles);
+        pendingBusCycles = 0;
+    }
+}
+
+// -------------------------------------------------------------
+//     CONTENÇÃO: fila do barramento/banco + row miss do acesso
+// -------------------------------------------------------------
+void MemoryManager::chargeBus(uint32_t address, PCB &process) {
+    if (!bus) return;
+
+    BusAccess r = bus->access(address, currentCore, currentTick);
+    process.memory_cycles.fetch_add(r.total());
+    process.bus_wait_cycles.fetch_add(r.total());
+}
+
+// -------------------------------------------------------------
+//            DRENAGEM EM SEGUNDO PLANO / FLUSH FINAL
+// -------------------------------------------------------------
+void MemoryManager::tick() {
+    writeBuffer.tick(this);
+
+    if (demandPaging) {
+        if (currentTick % agingInterval == 0)
+            replacer.ageTick(frames);
+
+        // Avança a "transferência" de cada processo esperando página
+        std::vector<PCB*> still;
+        for (PCB* p : pageWaiters) {
+            uint64_t w = p->page_fault_wait.load();
+            if (w <= 1) {
+                p->page_fault_wait.store(0);
+                pageReady.push_back(p);
+            } else {
+                p->page_fault_wait.store(w - 1);
+                still.push_back(p);
+            }
+        }
+        pageWaiters.swap(still);
+    }
+
+    currentTick++;
+}
+
+void MemoryManager::flush() {
+    // Buffer primeiro: linhas sujas na cache são sempre mais novas
+    writeBuffer.drainAll(this);
+    victimCache.flush(this);
+
+    if (L1_cache) {
+        for (auto &p : L1_cache->dirtyData())
+            writeToFile(p.first, p.second);
+    }
+}
+
+// -------------------------------------------------------------
+//        INVALIDAÇÃO NA TROCA DE CONTEXTO (cache/TLB sem ASID)
+// -------------------------------------------------------------
+uint64_t MemoryManager::invalidateCache(PCB& process) {
+    writeBuffer.drainAll(this);
+    victimCache.flush(this);
+    victimCache.invalidate();
+
+    if (!L1_cache) return 0;
+
+    uint64_t lines = 0;
+    for (auto &p : L1_cache->dirtyData()) {
+        writeToFile(p.first, p.second);
+        lines++;
+    }
+    L1_cache->invalidate();
+
+    return lines * process.memWeights.primary;
+}
+
+void MemoryManager::flushTLB(int core) {
+    if (core >= 0 && static_cast<size_t>(core) < tlbs.size())
+        tlbs[core].flush();
 }
 
 // -------------------------------------------------------------
@@ -206,3 +1603,22 @@ void MemoryManager::writeToFile(uint32_t address, uint32_t data) {
         secondaryMemory->WriteMem(secondaryAddress, data);
     }
 }
+
+// -------------------------------------------------------------
+//                 TRACE BINÁRIO DE ACESSOS
+// -------------------------------------------------------------
+bool MemoryManager::enableTrace(const std::string& path) {
+    traceWriter = std::make_unique<TraceWriter>(path);
+    if (!traceWriter->is_open()) {
+        traceWriter.reset();
+        return false;
+    }
+    return true;
+}
+
+void MemoryManager::closeTrace() {
+    if (traceWriter) {
+        traceWriter->close();
+        traceWriter.reset();
+    }
+}
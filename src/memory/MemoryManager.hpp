@@ -3,10 +3,21 @@
 #include <vector>
 #include <memory>
 #include <stdexcept>
+#include <set>
+#include <unordered_map>
 
 #include "MAIN_MEMORY.hpp"
 #include "SECONDARY_MEMORY.hpp"
 #include "cache.hpp"
+#include "WriteBuffer.hpp"
+#include "VictimCache.hpp"
+#include "MissClassifier.hpp"
+#include "StackDistanceProfiler.hpp"
+#include "CacheHeatmap.hpp"
+#include "MemoryTrace.hpp"
+#include "MemoryBus.hpp"
+#include "Numa.hpp"
+#include "Paging.hpp"
 #include "../cpu/PCB.hpp"
 #include "constants.hpp"
 
@@ -18,9 +29,57 @@ struct Partition {
     uint32_t size;      // tamanho total
     int pid;            // processo dono (-1 = livre)
     bool free;
+    uint32_t used;      // palavras pedidas pelo processo (fragmentação interna)
+    PCB* owner;         // dono (relocação na compactação)
 
     Partition(uint32_t b, uint32_t s)
-        : base(b), size(s), pid(-1), free(true) {}
+        : base(b), size(s), pid(-1), free(true), used(0), owner(nullptr) {}
+};
+
+// -------------------------------------------------------------
+//     Partições variáveis: estratégia de escolha do buraco
+// -------------------------------------------------------------
+enum class FitStrategy {
+    FIRST_FIT,
+    BEST_FIT,
+    WORST_FIT,
+    NEXT_FIT
+};
+
+// -------------------------------------------------------------
+//            Fragmentação da memória principal
+// -------------------------------------------------------------
+struct FragmentationStats {
+    uint32_t freeWords = 0;       // total livre
+    uint32_t largestHole = 0;     // maior bloco livre contíguo
+    uint32_t holes = 0;           // número de blocos livres
+    uint32_t internalWords = 0;   // alocado mas não pedido
+    double external = 0.0;        // 1 - maior buraco / livre (0..1)
+    double internal = 0.0;        // internalWords / alocado (0..1)
+};
+
+// -------------------------------------------------------------
+//            Modo de gerenciamento da memória principal
+// -------------------------------------------------------------
+enum class MemoryMode {
+    FIXED_PARTITIONS,   // partições fixas (createPartitions)
+    VARIABLE_PARTITIONS,// partições variáveis (createVariablePartitions)
+    BUDDY,              // buddy system (createBuddy)
+    PAGING              // páginas de tamanho fixo + TLB (createFrames)
+};
+
+// -------------------------------------------------------------
+//      Segmento de código compartilhado (somente leitura)
+// -------------------------------------------------------------
+// Uma única cópia física por conteúdo (hash das instruções). O espaço
+// pertence a um PCB interno (holder), alocado pelo alocador do modo
+// atual; os processos só apontam para ele. Liberado quando o último
+// processo que o usa termina.
+struct SharedCode {
+    uint64_t hash = 0;
+    std::vector<uint32_t> words;     // conteúdo (desempate de colisões)
+    std::unique_ptr<PCB> holder;     // dono do espaço físico
+    std::vector<PCB*> sharers;       // processos mapeados (= contagem de referências)
 };
 
 // -------------------------------------------------------------
@@ -37,14 +96,159 @@ public:
 private:
     uint32_t mainMemoryLimit;
 
-    // Partições fixas
+    // Política de escrita + write buffer
+    WritePolicy writePolicy;
+    WriteBuffer writeBuffer;
+
+    // Escritas síncronas pendentes de cobrança (write-backs de vítimas
+    // sujas ou drenagens forçadas por buffer cheio). São cobradas do
+    // processo que causou o acesso, com os pesos do próprio PCB.
+    uint64_t pendingPrimaryWrites = 0;
+    uint64_t pendingSecondaryWrites = 0;
+    uint64_t pendingBusCycles = 0;      // fila/row miss dessas escritas
+
+    // Victim cache (opcional) e classificação 3C dos misses da L1
+    VictimCache victimCache;
+    MissClassifier missClassifier;
+    bool classifyMisses = true;
+
+    // Profiler de distância de pilha (nullptr = desligado)
+    std::unique_ptr<StackDistanceProfiler> stackProfiler;
+
+    // Mapa de calor da L1 por região/conjunto e partição (nullptr = desligado)
+    std::unique_ptr<CacheHeatmap> heatmap;
+    int heatRegion(uint32_t address) const;
+
+    // Contenção no barramento / bancos da RAM (nullptr = custo fixo)
+    std::unique_ptr<MemoryBus> bus;
+    uint64_t lastDrainBusCycles = 0;    // custo da última drenagem do buffer
+
+    // Nós NUMA (nullptr = memória uniforme)
+    std::unique_ptr<NumaTopology> numa;
+    uint64_t nextInterleaveNode = 0;
+
+    uint64_t freeWordsOnNode(int node) const;
+    int homeNode(PCB &pcb);
+    int pageNode(PCB &pcb, uint32_t vpn);
+    uint64_t numaCycles(uint32_t address) const;
+    void chargeNuma(uint32_t address, PCB &process);
+
+    // Captura de trace binário (nullptr = desligado)
+    std::unique_ptr<TraceWriter> traceWriter;
+    uint64_t currentTick = 0;   // avançado por tick()
+    int currentCore = -1;       // definido pelo MultiCore antes de cada core
+
+    // Custo de hit na cache por core (cores heterogêneos; 0 = memWeights)
+    std::vector<uint64_t> coreCacheCycles;
+    uint64_t cacheCycles(const PCB &process) const {
+        if (currentCore >= 0 && static_cast<size_t>(currentCore) < coreCacheCycles.size()
+            && coreCacheCycles[currentCore] > 0)
+            return coreCacheCycles[currentCore];
+        return process.memWeights.cache;
+    }
+
+    inline void traceAccess(uint32_t address, const PCB &process,
+                            bool isWrite, bool isInstruction) {
+        if (!traceWriter) return;
+        TraceRecord r;
+        r.tick = currentTick;
+        r.core = currentCore;
+        r.pid = process.pid;
+        r.address = address;
+        r.isWrite = isWrite;
+        r.isInstruction = isInstruction;
+        traceWriter->record(r);
+    }
+
+    void chargePendingWrites(PCB &process);
+    void chargeBus(uint32_t address, PCB &process);
+    void recordCacheAccess(PCB &process, uint32_t address, bool hit);
+    void bufferedWrite(uint32_t address, uint32_t data);
+
+    MemoryMode mode = MemoryMode::FIXED_PARTITIONS;
+
+    // Partições fixas / variáveis (ordenadas por base) / blocos do buddy
     std::vector<Partition> partitions;
 
+    // Partições variáveis
+    FitStrategy fitStrategy = FitStrategy::FIRST_FIT;
+    uint32_t nextFitBase = 0;           // ponteiro do next-fit
+    bool compactionEnabled = false;
+    uint64_t compactions = 0;
+    uint64_t compactedWords = 0;
+
+    // Buddy: uma lista livre (ordenada) por ordem de bloco
+    uint32_t buddyMinOrder = 0;
+    uint32_t buddyMaxOrder = 0;
+    std::vector<std::set<uint32_t>> buddyFree;
+
+    int findHole(uint32_t sizeRequired, int node = -1) const;
+    bool allocateBuddy(PCB &pcb, uint32_t sizeRequired);
+    void freeBuddy(int pid);
+    void freeVariablePartition(int pid);
+    void purgeRange(uint32_t base, uint32_t length);
+
+    // Paginação
+    uint32_t pageSize = 0;
+    std::vector<Frame> frames;
+    std::vector<uint32_t> freeFrames;   // pilha de quadros livres
+    std::vector<TLB> tlbs;              // uma TLB por core
+    uint64_t tlbHitCycles = 0;
+    uint64_t tlbMissCycles = 5;         // page walk na tabela de páginas
+
+    // Paginação sob demanda: páginas vivem na memória secundária
+    // (swap) e só ocupam quadro depois da primeira falta
+    bool demandPaging = false;
+    size_t secondaryMemoryLimit;
+    std::vector<uint32_t> freeSwapSlots;   // slots devolvidos
+    uint64_t swapSlotCount = 0;
+    uint64_t nextSwapSlot = 0;             // slots nunca usados: [next, count)
+    PageReplacer replacer;
+    uint64_t agingInterval = 10;        // período do aging (LRU aproximado)
+    uint64_t pageIns = 0;
+    uint64_t pageOuts = 0;
+
+    // Processos bloqueados esperando a carga de uma página
+    std::vector<PCB*> pageWaiters;
+    std::vector<PCB*> pageReady;
+
+    // Carga em bloco (DMA): custo opcional por transferência
+    uint64_t dmaSetupCycles = 0;
+    uint64_t dmaWordsPerCycle = 0;      // 0 = DMA sem custo modelado
+    uint64_t dmaCycles = 0;
+
+    // Código compartilhado (loadProgram); chave = pid interno do holder
+    bool sharedCodeEnabled = false;
+    bool copyOnWrite = false;
+    std::unordered_map<int, std::unique_ptr<SharedCode>> sharedCode;
+    std::unordered_multimap<uint64_t, int> sharedByHash;
+    int nextSharedId = -2;              // pids internos (-1 = partição livre)
+    uint64_t sharedReuses = 0;          // cargas que reaproveitaram uma cópia
+    uint64_t sharedWordsSaved = 0;
+    uint64_t cowCopies = 0;
+
+    SharedCode* acquireSharedCode(PCB &pcb, bool &created);
+    bool mapSharedCode(PCB &pcb, SharedCode &sc);
+    void releaseSharedCode(PCB &pcb);
+    void dropSharedCode(int id);
+    void copyOnWritePage(PCB &pcb, uint32_t vpn);
+
+    uint32_t translate(uint32_t logicalAddr, PCB &pcb, bool isWrite);
+    PageTableEntry& effectivePTE(PCB &pcb, uint32_t vpn, PCB *&owner, uint32_t &ownerVpn);
+    uint32_t takeFreeFrame(int node);
+    uint32_t acquireFrame(PCB &charged, int node = -1);
+    void servicePageFault(PCB &owner, uint32_t vpn, PCB &charged);
+    void evictFrame(uint32_t frame, PCB &faulting);
+    PageTableEntry* swappedOutPage(uint32_t logicalAddr, PCB &pcb);
+
 public:
     MemoryManager(size_t mainMemorySize,
               size_t secondaryMemorySize,
               size_t cacheCapacity,
-              CachePolicyType cachePolicy = CachePolicyType::FIFO);
+              CachePolicyType cachePolicy = CachePolicyType::FIFO,
+              WritePolicy writePolicy = WritePolicy::WRITE_BACK,
+              size_t writeBufferCapacity = 8,
+              uint64_t writeBufferDrainInterval = 5);
 
 
     // ---------- Partições Fixas ----------
@@ -52,14 +256,155 @@ public:
     Partition* allocateFixedPartition(PCB &pcb, uint32_t sizeRequired);
     void freePartition(int pid);
 
+    // ---------- Partições variáveis / buddy ----------
+    void createVariablePartitions(FitStrategy fit, bool compaction = false);
+    Partition* allocateVariablePartition(PCB &pcb, uint32_t sizeRequired);
+    uint64_t compact();                    // retorna palavras movidas
+    void createBuddy(uint32_t minBlock = 16);
+
+    FragmentationStats fragmentation() const;
+    uint64_t get_compactions()    const { return compactions; }
+    uint64_t get_compactedWords() const { return compactedWords; }
+
+    // ---------- Paginação ----------
+    void createFrames(uint32_t pageSize);
+    bool allocatePages(PCB &pcb, uint32_t sizeRequired);
+    void freePages(PCB &pcb);
+    void configureTLB(size_t numCores, size_t entries, size_t ways,
+                      uint64_t hitCycles, uint64_t missCycles);
+
+    // ---------- Paginação sob demanda (swap) ----------
+    // Troca a memória secundária por um arquivo esparso mapeado
+    // (chamar antes de enableDemandPaging). false = ficou no vetor.
+    bool useSecondaryBackingFile(const std::string &path, size_t words);
+    const SECONDARY_MEMORY& getSecondaryMemory() const { return *secondaryMemory; }
+    const MAIN_MEMORY& getMainMemory() const { return *mainMemory; }
+    void enableDemandPaging(PageReplacementPolicy policy,
+                            uint64_t workingSetWindow = 50,
+                            uint64_t agingInterval = 10);
+    bool isDemandPaging() const { return demandPaging; }
+
+    // Fila de espera por página (o processo bloqueia como em IO)
+    void blockOnPageFault(PCB* pcb);
+    std::vector<PCB*> takePageReady();
+    size_t pageWaitingCount() const { return pageWaiters.size(); }
+
+    uint64_t get_pageIns()  const { return pageIns; }
+    uint64_t get_pageOuts() const { return pageOuts; }
+
+    // ---------- Alocação conforme o modo ----------
+    bool allocateProcess(PCB &pcb, uint32_t sizeRequired);
+    void freeProcess(PCB &pcb);
+
+    // ---------- Código compartilhado ----------
+    // loadProgram aloca o processo e carrega DATA + CODE (CODE logo após
+    // DATA). Com compartilhamento ligado, programas com o mesmo CODE usam
+    // uma única cópia física, contada por referência. Escrita no código:
+    // cópia privada da página (copy-on-write, só no modo PAGING) ou erro.
+    void enableSharedCode(bool copyOnWrite_ = false) {
+        sharedCodeEnabled = true;
+        copyOnWrite = copyOnWrite_;
+    }
+    bool loadProgram(PCB &pcb);
+
+    size_t   get_sharedSegments()   const { return sharedCode.size(); }
+    uint64_t get_sharedReuses()     const { return sharedReuses; }
+    uint64_t get_sharedWordsSaved() const { return sharedWordsSaved; }
+    uint64_t get_cowCopies()        const { return cowCopies; }
+
     uint32_t resolveAddress(uint32_t logicalAddr, const PCB &pcb);
-    uint32_t readLogical(uint32_t logicalAddr, PCB &pcb);
+    uint32_t readLogical(uint32_t logicalAddr, PCB &pcb, bool isInstruction = false);
     void writeLogical(uint32_t logicalAddr, uint32_t data, PCB &pcb);
 
+    // ---------- Carga em bloco (DMA) ----------
+    // Copia palavras direto para a RAM (ou swap) do processo, sem
+    // passar pela cache e sem contar acessos do processo. Linhas da
+    // cache que apontam para a faixa são invalidadas.
+    void loadSegment(PCB &pcb, const uint32_t* words, size_t count,
+                     uint32_t logicalOffset = 0);
+    void loadSegment(PCB &pcb, const std::vector<uint32_t> &words,
+                     uint32_t logicalOffset = 0) {
+        loadSegment(pcb, words.data(), words.size(), logicalOffset);
+    }
+    void setDMACost(uint64_t setupCycles, uint64_t wordsPerCycle) {
+        dmaSetupCycles = setupCycles;
+        dmaWordsPerCycle = wordsPerCycle;
+    }
+    uint64_t get_dmaCycles() const { return dmaCycles; }
+
     // ---------- Acesso Físico ----------
-    uint32_t read(uint32_t address, PCB& process);
+    uint32_t read(uint32_t address, PCB& process, bool isInstruction = false);
     void write(uint32_t address, uint32_t data, PCB& process);
     void writeToFile(uint32_t address, uint32_t data);
+    void drainWrite(uint32_t address, uint32_t data);  // vinda do write buffer
+
+    // ---------- Política de escrita / write buffer ----------
+    void writeBack(uint32_t address, uint32_t data);   // vítima suja da cache
+    void evictFromL1(uint32_t address, uint32_t data, bool dirty);
+    void tick();                                       // 1 ciclo de drenagem
+    void flush();                                      // drena buffer + linhas sujas
+
+    // ---------- Troca de contexto sem ASID ----------
+    // Invalida a cache depois de gravar as linhas sujas (custo em ciclos
+    // devolvido, cobrado de process) e esvazia a TLB de um core
+    uint64_t invalidateCache(PCB& process);
+    void flushTLB(int core);
+
+    WritePolicy getWritePolicy() const { return writePolicy; }
+    const WriteBuffer& getWriteBuffer() const { return writeBuffer; }
+
+    // ---------- Victim cache / classificação de misses ----------
+    void setVictimCache(size_t entries) { victimCache = VictimCache(entries); }
+    void setMissClassification(bool on) { classifyMisses = on; }
+
+    const VictimCache& getVictimCache() const { return victimCache; }
+    const MissClassifier& getMissClassifier() const { return missClassifier; }
+
+    // ---------- Contenção de memória entre cores ----------
+    void enableMemoryBus(const MemoryBusConfig &config, size_t numCores) {
+        bus = std::make_unique<MemoryBus>(config, numCores);
+    }
+    const MemoryBus* getMemoryBus() const { return bus.get(); }
+
+    // ---------- NUMA ----------
+    // RAM dividida em `nodes` faixas iguais; cores entram nos nós por
+    // setCoreNode (MultiCore::assignNumaNodes). Chamar depois de criar
+    // partições/quadros e antes de alocar processos.
+    void enableNuma(size_t nodes, NumaPlacement placement,
+                    uint64_t localCycles = 0, uint64_t remoteCycles = 10);
+    void setCoreNode(int core, int node) { if (numa) numa->setCoreNode(core, node); }
+    NumaTopology* getNuma() { return numa.get(); }
+    const NumaTopology* getNuma() const { return numa.get(); }
+
+    // ---------- Curva de miss (todas as capacidades numa passada) ----------
+    void enableStackProfiler() { stackProfiler = std::make_unique<StackDistanceProfiler>(); }
+    const StackDistanceProfiler* getStackProfiler() const { return stackProfiler.get(); }
+
+    // ---------- Mapa de calor da cache ----------
+    // sets == 0: buckets de bucketWords palavras; sets > 0: conjunto
+    // (endereço % sets). Chamar depois de escolher o tamanho da RAM.
+    void enableCacheHeatmap(uint32_t bucketWords, uint64_t windowTicks, size_t sets = 0) {
+        heatmap = std::make_unique<CacheHeatmap>(mainMemoryLimit, bucketWords,
+                                                 windowTicks, sets);
+    }
+    const CacheHeatmap* getCacheHeatmap() const { return heatmap.get(); }
+    const Cache* getCache() const { return L1_cache.get(); }
+
+    // ---------- Trace binário de acessos ----------
+    bool enableTrace(const std::string& path);
+    void closeTrace();
+    const TraceWriter* getTraceWriter() const { return traceWriter.get(); }
+
+    void setCurrentCore(int coreId) { currentCore = coreId; }
+
+    // Cache mais rápida/lenta para um core (0 = peso do processo)
+    void setCoreCacheCycles(int core, uint64_t cycles) {
+        if (core < 0) return;
+        if (static_cast<size_t>(core) >= coreCacheCycles.size())
+            coreCacheCycles.resize(core + 1, 0);
+        coreCacheCycles[core] = cycles;
+    }
+    uint64_t getCurrentTick() const { return currentTick; }
 
     // ---------- Auxiliar ----------
     inline void contabiliza_cache(PCB &pcb, bool hit) {
@@ -68,4 +413,11 @@ public:
     }
 
     const std::vector<Partition>& getPartitions() const { return partitions; }
+    const std::vector<Frame>& getFrames() const { return frames; }
+    const std::vector<TLB>& getTLBs() const { return tlbs; }
+    MemoryMode getMode() const { return mode; }
+    uint32_t getPageSize() const { return pageSize; }
+
+    // Ocupação da memória principal (% de partições ou quadros em uso)
+    double usagePercent() const;
 };
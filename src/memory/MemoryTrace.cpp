@@ -0,0 +1,225 @@
+#include "MemoryTrace.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char     TRACE_MAGIC[4] = {'V', 'N', 'M', 'T'};
+static const uint32_t TRACE_VERSION  = 1;
+
+static void putU32(std::vector<uint8_t>& buf, uint32_t v) {
+    for (int i = 0; i < 4; i++) buf.push_back(static_cast<uint8_t>(v >> (8 * i)));
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return  static_cast<uint32_t>(p[0])        | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// ==========================================================
+//                      TRACE WRITER
+// ==========================================================
+TraceWriter::TraceWriter(const std::string& path, uint32_t recordsPerBlock_)
+    : out(path, std::ios::binary | std::ios::trunc),
+      blockRecords(0),
+      recordsPerBlock(recordsPerBlock_ == 0 ? 1 : recordsPerBlock_),
+      totalRecords(0),
+      totalBytes(0)
+{
+    resetDeltas();
+
+    if (!out.is_open()) {
+        std::cerr << "[MemoryTrace] Não foi possível abrir " << path << "\n";
+        return;
+    }
+
+    std::vector<uint8_t> header(TRACE_MAGIC, TRACE_MAGIC + 4);
+    putU32(header, TRACE_VERSION);
+    out.write(reinterpret_cast<const char*>(header.data()), header.size());
+    totalBytes += header.size();
+
+    block.reserve(recordsPerBlock * 4);
+}
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+void TraceWriter::resetDeltas() {
+    lastTick = 0;
+    lastAddress = 0;
+    lastPid = 0;
+    lastCore = -1;
+}
+
+void TraceWriter::putVarint(uint64_t v) {
+    while (v >= 0x80) {
+        block.push_back(static_cast<uint8_t>(v) | 0x80);
+        v >>= 7;
+    }
+    block.push_back(static_cast<uint8_t>(v));
+}
+
+void TraceWriter::putZigzag(int64_t v) {
+    putVarint((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+}
+
+void TraceWriter::record(const TraceRecord& r) {
+    if (!out.is_open()) return;
+
+    uint8_t flags = 0;
+    if (r.isWrite)         flags |= 0x01;
+    if (r.isInstruction)   flags |= 0x02;
+    if (r.pid  != lastPid)  flags |= 0x04;
+    if (r.core != lastCore) flags |= 0x08;
+
+    block.push_back(flags);
+    putVarint(r.tick - lastTick);
+    putZigzag(static_cast<int64_t>(r.address) - static_cast<int64_t>(lastAddress));
+    if (flags & 0x04) putZigzag(r.pid);
+    if (flags & 0x08) putZigzag(r.core);
+
+    lastTick = r.tick;
+    lastAddress = r.address;
+    lastPid = r.pid;
+    lastCore = r.core;
+
+    totalRecords++;
+    if (++blockRecords >= recordsPerBlock) flushBlock();
+}
+
+void TraceWriter::flushBlock() {
+    if (blockRecords == 0) return;
+
+    std::vector<uint8_t> header;
+    putU32(header, blockRecords);
+    putU32(header, static_cast<uint32_t>(block.size()));
+
+    out.write(reinterpret_cast<const char*>(header.data()), header.size());
+    out.write(reinterpret_cast<const char*>(block.data()), block.size());
+    totalBytes += header.size() + block.size();
+
+    block.clear();
+    blockRecords = 0;
+    resetDeltas();
+}
+
+void TraceWriter::close() {
+    if (!out.is_open()) return;
+    flushBlock();
+    out.close();
+}
+
+// ==========================================================
+//                      TRACE READER
+// ==========================================================
+TraceReader::TraceReader(const std::string& path)
+    : fd(-1), base(nullptr), length(0), pos(0), blockEnd(0), blockLeft(0)
+{
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[MemoryTrace] Não foi possível abrir " << path << "\n";
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 8) {
+        std::cerr << "[MemoryTrace] Trace vazio ou inválido: " << path << "\n";
+        return;
+    }
+    length = static_cast<size_t>(st.st_size);
+
+    void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+        std::cerr << "[MemoryTrace] mmap falhou: " << path << "\n";
+        length = 0;
+        return;
+    }
+    madvise(p, length, MADV_SEQUENTIAL);
+
+    base = static_cast<const uint8_t*>(p);
+    if (std::memcmp(base, TRACE_MAGIC, 4) != 0 || getU32(base + 4) != TRACE_VERSION) {
+        std::cerr << "[MemoryTrace] Cabeçalho inválido: " << path << "\n";
+        munmap(p, length);
+        base = nullptr;
+        length = 0;
+        return;
+    }
+
+    rewind();
+}
+
+TraceReader::~TraceReader() {
+    if (base) munmap(const_cast<uint8_t*>(base), length);
+    if (fd >= 0) ::close(fd);
+}
+
+void TraceReader::rewind() {
+    pos = 8;
+    blockEnd = pos;
+    blockLeft = 0;
+}
+
+bool TraceReader::getVarint(uint64_t &v) {
+    v = 0;
+    for (int shift = 0; pos < blockEnd && shift < 64; shift += 7) {
+        uint8_t b = base[pos++];
+        v |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+bool TraceReader::getZigzag(int64_t &v) {
+    uint64_t u;
+    if (!getVarint(u)) return false;
+    v = static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+    return true;
+}
+
+bool TraceReader::openBlock() {
+    if (pos + 8 > length) return false;
+
+    blockLeft = getU32(base + pos);
+    uint32_t payload = getU32(base + pos + 4);
+    pos += 8;
+
+    if (pos + payload > length) return false;
+    blockEnd = pos + payload;
+
+    // Deltas reiniciam a cada bloco
+    last = TraceRecord();
+    return true;
+}
+
+bool TraceReader::next(TraceRecord& r) {
+    if (!base) return false;
+
+    while (blockLeft == 0) {
+        pos = blockEnd;
+        if (!openBlock()) return false;
+    }
+
+    if (pos >= blockEnd) return false;
+    uint8_t flags = base[pos++];
+
+    uint64_t dt;
+    int64_t da, v;
+    if (!getVarint(dt) || !getZigzag(da)) return false;
+
+    last.tick += dt;
+    last.address = static_cast<uint32_t>(static_cast<int64_t>(last.address) + da);
+    last.isWrite = flags & 0x01;
+    last.isInstruction = flags & 0x02;
+
+    if (flags & 0x04) { if (!getZigzag(v)) return false; last.pid  = static_cast<int32_t>(v); }
+    if (flags & 0x08) { if (!getZigzag(v)) return false; last.core = static_cast<int32_t>(v); }
+
+    blockLeft--;
+    r = last;
+    return true;
+}
@@ -0,0 +1,108 @@
+#ifndef MEMORY_TRACE_HPP
+#define MEMORY_TRACE_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <fstream>
+
+// -------------------------------------------------------------
+//                 TRACE BINÁRIO DE ACESSOS
+// -------------------------------------------------------------
+// Formato (little-endian):
+//   header : "VNMT" + uint32 versão
+//   blocos : uint32 nº de registros + uint32 bytes do payload + payload
+// Cada bloco é independente (deltas reiniciam no início do bloco).
+// Registro no payload:
+//   1 byte de flags  (bit0 escrita, bit1 instrução,
+//                     bit2 pid mudou, bit3 core mudou)
+//   varint           delta do tick
+//   varint zigzag    delta do endereço
+//   varint zigzag    pid   (se bit2)
+//   varint zigzag    core  (se bit3; -1 = fora de um core)
+// -------------------------------------------------------------
+
+struct TraceRecord {
+    uint64_t tick = 0;
+    int32_t  core = -1;
+    int32_t  pid = 0;
+    uint32_t address = 0;
+    bool     isWrite = false;
+    bool     isInstruction = false;
+};
+
+// -------------------------------------------------------------
+//             ESCRITOR (bufferizado por bloco)
+// -------------------------------------------------------------
+class TraceWriter {
+private:
+    std::ofstream out;
+    std::vector<uint8_t> block;
+    uint32_t blockRecords;
+    uint32_t recordsPerBlock;
+
+    // Estado dos deltas dentro do bloco corrente
+    uint64_t lastTick;
+    uint32_t lastAddress;
+    int32_t  lastPid;
+    int32_t  lastCore;
+
+    uint64_t totalRecords;
+    uint64_t totalBytes;
+
+    void putVarint(uint64_t v);
+    void putZigzag(int64_t v);
+    void resetDeltas();
+    void flushBlock();
+
+public:
+    explicit TraceWriter(const std::string& path, uint32_t recordsPerBlock_ = 4096);
+    ~TraceWriter();
+
+    bool is_open() const { return out.is_open(); }
+
+    void record(const TraceRecord& r);
+    void close();
+
+    uint64_t get_records() const { return totalRecords; }
+    uint64_t get_bytes()   const { return totalBytes; }
+};
+
+// -------------------------------------------------------------
+//             LEITOR (entrada mapeada com mmap)
+// -------------------------------------------------------------
+class TraceReader {
+private:
+    int fd;
+    const uint8_t* base;
+    size_t length;
+
+    size_t pos;          // posição no arquivo
+    size_t blockEnd;     // fim do payload do bloco corrente
+    uint32_t blockLeft;  // registros restantes no bloco
+
+    TraceRecord last;
+
+    bool getVarint(uint64_t &v);
+    bool getZigzag(int64_t &v);
+    bool openBlock();
+
+public:
+    explicit TraceReader(const std::string& path);
+    ~TraceReader();
+
+    TraceReader(const TraceReader&) = delete;
+    TraceReader& operator=(const TraceReader&) = delete;
+
+    bool is_open() const { return base != nullptr; }
+    size_t size_bytes() const { return length; }
+
+    // Próximo registro; false no fim do arquivo (ou arquivo inválido)
+    bool next(TraceRecord& r);
+
+    // Recomeça do primeiro bloco
+    void rewind();
+};
+
+#endif
@@ -0,0 +1,53 @@
+#include "MissClassifier.hpp"
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+MissClassifier::MissClassifier(size_t capacity_)
+    : capacity(capacity_), compulsory(0), capacityMisses(0), conflict(0)
+{
+}
+
+// --------------------------------------------------
+// ACCESS — atualiza a sombra e classifica o miss
+// --------------------------------------------------
+MissType MissClassifier::access(uint32_t address, bool realHit) {
+
+    bool firstTouch = seen.insert(address).second;
+
+    // Sombra totalmente associativa LRU
+    bool shadowHit = false;
+    auto it = shadow_pos.find(address);
+    if (it != shadow_pos.end()) {
+        shadowHit = true;
+        shadow_lru.splice(shadow_lru.end(), shadow_lru, it->second);
+    } else if (capacity > 0) {
+        if (shadow_lru.size() >= capacity) {
+            shadow_pos.erase(shadow_lru.front());
+            shadow_lru.pop_front();
+        }
+        shadow_lru.push_back(address);
+        shadow_pos[address] = std::prev(shadow_lru.end());
+    }
+
+    if (realHit) return MissType::NONE;
+
+    if (firstTouch) {
+        compulsory++;
+        return MissType::COMPULSORY;
+    }
+    if (!shadowHit) {
+        capacityMisses++;
+        return MissType::CAPACITY;
+    }
+    conflict++;
+    return MissType::CONFLICT;
+}
+
+// --------------------------------------------------
+void MissClassifier::reset() {
+    seen.clear();
+    shadow_lru.clear();
+    shadow_pos.clear();
+    compulsory = capacityMisses = conflict = 0;
+}
@@ -0,0 +1,49 @@
+#ifndef MISS_CLASSIFIER_HPP
+#define MISS_CLASSIFIER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
+// Classificação de misses (modelo dos 3C)
+enum class MissType {
+    NONE,        // hit
+    COMPULSORY,  // primeira referência ao endereço
+    CAPACITY,    // também erraria numa cache totalmente associativa LRU
+    CONFLICT     // acertaria na totalmente associativa LRU (mapeamento/política)
+};
+
+// -------------------------------------------------------------
+//                     MISS CLASSIFIER
+// -------------------------------------------------------------
+// Mantém uma cache-sombra totalmente associativa LRU com a mesma
+// capacidade da L1. Deve ver TODOS os acessos (hits e misses) para
+// que a sombra fique sincronizada com o fluxo de referências.
+class MissClassifier {
+private:
+    size_t capacity;
+
+    std::unordered_set<uint32_t> seen;
+    std::list<uint32_t> shadow_lru;   // front = menos recente
+    std::unordered_map<uint32_t, std::list<uint32_t>::iterator> shadow_pos;
+
+    uint64_t compulsory;
+    uint64_t capacityMisses;
+    uint64_t conflict;
+
+public:
+    explicit MissClassifier(size_t capacity_);
+
+    // Registra o acesso e, se realHit == false, classifica o miss
+    MissType access(uint32_t address, bool realHit);
+
+    void reset();
+
+    uint64_t get_compulsory() const { return compulsory; }
+    uint64_t get_capacity()   const { return capacityMisses; }
+    uint64_t get_conflict()   const { return conflict; }
+};
+
+#endif
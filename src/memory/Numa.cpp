@@ -0,0 +1,22 @@
+#include "Numa.hpp"
+
+// --------------------------------------------------
+// Construtor: nós de tamanho igual, matriz local/remoto
+// --------------------------------------------------
+NumaTopology::NumaTopology(size_t nodes_, uint32_t memoryWords, NumaPlacement placement_,
+                           uint64_t localCycles, uint64_t remoteCycles)
+    : nodes(nodes_ == 0 ? 1 : nodes_),
+      placement(placement_)
+{
+    nodeWords = static_cast<uint32_t>(memoryWords / nodes);
+    if (nodeWords == 0) nodeWords = 1;
+
+    matrix.assign(nodes, std::vector<uint64_t>(nodes, remoteCycles));
+    for (size_t i = 0; i < nodes; i++) matrix[i][i] = localCycles;
+}
+
+void NumaTopology::setCoreNode(int core, int node) {
+    if (core < 0) return;
+    if (static_cast<size_t>(core) >= coreNode.size()) coreNode.resize(core + 1, 0);
+    coreNode[core] = node;
+}
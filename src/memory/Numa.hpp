@@ -0,0 +1,57 @@
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// -------------------------------------------------------------
+//            Posicionamento da memória entre os nós
+// -------------------------------------------------------------
+enum class NumaPlacement {
+    FIRST_TOUCH,   // no nó de quem usa primeiro (core da falta / nó do processo)
+    INTERLEAVED    // páginas alternadas entre os nós (partições: por processo)
+};
+
+// -------------------------------------------------------------
+//                     TOPOLOGIA NUMA
+// -------------------------------------------------------------
+// A RAM é dividida em `nodes` faixas contíguas do mesmo tamanho; cada
+// core pertence a um nó. Um acesso do nó `from` à memória do nó `to`
+// custa latency(from, to) ciclos além de memWeights.primary (matriz
+// configurável; por padrão local = localCycles, remoto = remoteCycles).
+class NumaTopology {
+private:
+    size_t nodes;
+    uint32_t nodeWords;                       // palavras por nó
+    std::vector<std::vector<uint64_t>> matrix;
+    std::vector<int> coreNode;
+    NumaPlacement placement;
+
+public:
+    NumaTopology(size_t nodes, uint32_t memoryWords, NumaPlacement placement,
+                 uint64_t localCycles = 0, uint64_t remoteCycles = 10);
+
+    size_t numNodes() const { return nodes; }
+    NumaPlacement getPlacement() const { return placement; }
+
+    // Nó dono de um endereço físico
+    int nodeOf(uint32_t address) const {
+        size_t n = address / nodeWords;
+        return static_cast<int>(n < nodes ? n : nodes - 1);
+    }
+    uint32_t nodeBase(int node) const { return static_cast<uint32_t>(node) * nodeWords; }
+    uint32_t nodeSize() const { return nodeWords; }
+
+    // Cores → nós (MultiCore::assignNumaNodes)
+    void setCoreNode(int core, int node);
+    int nodeOfCore(int core) const {
+        if (core < 0 || static_cast<size_t>(core) >= coreNode.size()) return -1;
+        return coreNode[core];
+    }
+
+    void setLatency(int from, int to, uint64_t cycles) { matrix[from][to] = cycles; }
+    uint64_t latency(int from, int to) const { return matrix[from][to]; }
+};
+
+#endif
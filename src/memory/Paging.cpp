@@ -0,0 +1,241 @@
+#include "Paging.hpp"
+#include "../cpu/PCB.hpp"
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+TLB::TLB(size_t entries_, size_t ways_)
+    : useClock(0), hits(0), misses(0)
+{
+    if (entries_ == 0) entries_ = 1;
+    if (ways_ == 0 || ways_ > entries_) ways_ = entries_;
+
+    ways = ways_;
+    numSets = entries_ / ways_;
+    entries.resize(numSets * ways);
+}
+
+// --------------------------------------------------
+// LOOKUP
+// --------------------------------------------------
+bool TLB::lookup(int pid, uint32_t vpn, uint32_t &frame) {
+    size_t set = vpn % numSets;
+    Entry* base = &entries[set * ways];
+
+    for (size_t w = 0; w < ways; w++) {
+        Entry &e = base[w];
+        if (e.valid && e.pid == pid && e.vpn == vpn) {
+            e.lastUse = ++useClock;
+            frame = e.frame;
+            hits++;
+            return true;
+        }
+    }
+
+    misses++;
+    return false;
+}
+
+// --------------------------------------------------
+// INSERT (LRU dentro do conjunto)
+// --------------------------------------------------
+void TLB::insert(int pid, uint32_t vpn, uint32_t frame) {
+    size_t set = vpn % numSets;
+    Entry* base = &entries[set * ways];
+
+    Entry* victim = &base[0];
+    for (size_t w = 0; w < ways; w++) {
+        Entry &e = base[w];
+        if (!e.valid) { victim = &e; break; }
+        if (e.lastUse < victim->lastUse) victim = &e;
+    }
+
+    victim->valid = true;
+    victim->pid = pid;
+    victim->vpn = vpn;
+    victim->frame = frame;
+    victim->lastUse = ++useClock;
+}
+
+// --------------------------------------------------
+// INVALIDAÇÃO
+// --------------------------------------------------
+void TLB::invalidate(int pid, uint32_t vpn) {
+    size_t set = vpn % numSets;
+    Entry* base = &entries[set * ways];
+
+    for (size_t w = 0; w < ways; w++) {
+        if (base[w].valid && base[w].pid == pid && base[w].vpn == vpn)
+            base[w].valid = false;
+    }
+}
+
+void TLB::flushPid(int pid) {
+    for (auto &e : entries)
+        if (e.pid == pid) e.valid = false;
+}
+
+void TLB::flush() {
+    for (auto &e : entries) e.valid = false;
+}
+
+// ==================================================
+//           SUBSTITUIÇÃO DE PÁGINAS
+// ==================================================
+PageReplacer::PageReplacer(PageReplacementPolicy p, uint64_t window_)
+    : policy(p), window(window_ == 0 ? 1 : window_), hand(0)
+{
+}
+
+void PageReplacer::reset(size_t numFrames) {
+    hand = 0;
+    loadOrder.clear();
+    age.assign(numFrames, 0);
+}
+
+void PageReplacer::onLoad(uint32_t frame) {
+    if (policy == PageReplacementPolicy::FIFO)
+        loadOrder.push_back(frame);
+    if (frame < age.size())
+        age[frame] = 0x80;   // recém-carregada conta como referenciada
+}
+
+void PageReplacer::onFree(uint32_t frame) {
+    if (policy == PageReplacementPolicy::FIFO) {
+        for (auto it = loadOrder.begin(); it != loadOrder.end(); ++it) {
+            if (*it == frame) { loadOrder.erase(it); break; }
+        }
+    }
+    if (frame < age.size()) age[frame] = 0;
+}
+
+// --------------------------------------------------
+// AGING — chamado periodicamente pelo MemoryManager
+// --------------------------------------------------
+void PageReplacer::ageTick(const std::vector<Frame> &frames) {
+    if (policy != PageReplacementPolicy::LRU_APPROX) return;
+
+    for (size_t f = 0; f < frames.size() && f < age.size(); f++) {
+        const Frame &fr = frames[f];
+        if (fr.free || !fr.owner) continue;
+
+        PageTableEntry &pte = fr.owner->pageTable[fr.page];
+        age[f] = static_cast<uint8_t>((age[f] >> 1) | (pte.referenced ? 0x80 : 0));
+        pte.referenced = false;
+    }
+}
+
+// --------------------------------------------------
+// SELEÇÃO DA VÍTIMA
+// --------------------------------------------------
+uint32_t PageReplacer::selectVictim(const std::vector<Frame> &frames, uint64_t now) {
+    switch (policy) {
+        case PageReplacementPolicy::FIFO:        return selectFIFO(frames);
+        case PageReplacementPolicy::LRU_APPROX:  return selectAging(frames);
+        case PageReplacementPolicy::WSCLOCK:     return selectWSClock(frames, now);
+        case PageReplacementPolicy::WORKING_SET: return selectWorkingSet(frames, now);
+        case PageReplacementPolicy::CLOCK:
+        default:                                 return selectClock(frames);
+    }
+}
+
+uint32_t PageReplacer::selectFIFO(const std::vector<Frame> &frames) {
+    while (!loadOrder.empty()) {
+        uint32_t f = loadOrder.front();
+        loadOrder.pop_front();
+        if (!frames[f].free) return f;
+    }
+    return selectClock(frames);
+}
+
+uint32_t PageReplacer::selectClock(const std::vector<Frame> &frames) {
+    // No máximo duas voltas: a primeira limpa todos os bits R
+    for (size_t step = 0; step < 2 * frames.size(); step++) {
+        size_t f = hand;
+        hand = (hand + 1) % frames.size();
+
+        const Frame &fr = frames[f];
+        if (fr.free || !fr.owner) continue;
+
+        PageTableEntry &pte = fr.owner->pageTable[fr.page];
+        if (pte.referenced) {
+            pte.referenced = false;   // segunda chance
+            continue;
+        }
+        return static_cast<uint32_t>(f);
+    }
+    return static_cast<uint32_t>(hand);
+}
+
+uint32_t PageReplacer::selectAging(const std::vector<Frame> &frames) {
+    // Menor contador perde; bit R atual entra como bit mais significativo
+    uint32_t victim = 0;
+    int best = 0x1FF;
+
+    for (size_t f = 0; f < frames.size(); f++) {
+        const Frame &fr = frames[f];
+        if (fr.free || !fr.owner) continue;
+
+        const PageTableEntry &pte = fr.owner->pageTable[fr.page];
+        int value = (pte.referenced ? 0x100 : 0) | age[f];
+        if (value < best) {
+            best = value;
+            victim = static_cast<uint32_t>(f);
+        }
+    }
+    return victim;
+}
+
+uint32_t PageReplacer::selectWSClock(const std::vector<Frame> &frames, uint64_t now) {
+    int dirtyOld = -1;   // página velha mas suja (exige write-back)
+    int anyClean = -1;
+
+    for (size_t step = 0; step < frames.size(); step++) {
+        size_t f = hand;
+        hand = (hand + 1) % frames.size();
+
+        const Frame &fr = frames[f];
+        if (fr.free || !fr.owner) continue;
+
+        PageTableEntry &pte = fr.owner->pageTable[fr.page];
+        if (pte.referenced) {
+            pte.referenced = false;
+            pte.lastUse = now;
+            continue;
+        }
+
+        bool old = now - pte.lastUse > window;
+        if (old && !pte.dirty) return static_cast<uint32_t>(f);
+        if (old && dirtyOld < 0) dirtyOld = static_cast<int>(f);
+        if (!pte.dirty && anyClean < 0) anyClean = static_cast<int>(f);
+    }
+
+    if (dirtyOld >= 0) return static_cast<uint32_t>(dirtyOld);
+    if (anyClean >= 0) return static_cast<uint32_t>(anyClean);
+    return selectClock(frames);
+}
+
+uint32_t PageReplacer::selectWorkingSet(const std::vector<Frame> &frames, uint64_t now) {
+    // Varre tudo: fora da janela tau sai já; senão a de uso mais antigo
+    int oldest = -1;
+    uint64_t oldestUse = UINT64_MAX;
+
+    for (size_t f = 0; f < frames.size(); f++) {
+        const Frame &fr = frames[f];
+        if (fr.free || !fr.owner) continue;
+
+        PageTableEntry &pte = fr.owner->pageTable[fr.page];
+        if (pte.referenced) {
+            pte.referenced = false;
+            pte.lastUse = now;
+        } else if (now - pte.lastUse > window) {
+            return static_cast<uint32_t>(f);
+        }
+
+        if (pte.lastUse < oldestUse) {
+            oldestUse = pte.lastUse;
+            oldest = static_cast<int>(f);
+        }
+    }
+    return oldest >= 0 ? static_cast<uint32_t>(oldest) : 0;
+}
@@ -0,0 +1,119 @@
+#ifndef PAGING_HPP
+#define PAGING_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <deque>
+
+struct PCB;
+
+// -------------------------------------------------------------
+//                  ENTRADA DA TABELA DE PÁGINAS
+// -------------------------------------------------------------
+struct PageTableEntry {
+    uint32_t frame = 0;       // quadro físico
+    bool valid = false;       // página presente na RAM
+    bool referenced = false;  // bit R (atualizado em cada acesso)
+    bool dirty = false;       // bit M (escrita desde a carga)
+    int32_t swapSlot = -1;    // slot na memória secundária (paginação sob demanda)
+    uint64_t lastUse = 0;     // tick do último acesso (working set / WSClock)
+    bool shared = false;      // código compartilhado: a entrada real é a do dono do segmento
+};
+
+// -------------------------------------------------------------
+//                     QUADRO FÍSICO
+// -------------------------------------------------------------
+struct Frame {
+    uint32_t base;      // endereço físico inicial
+    int pid;            // processo dono (-1 = livre)
+    uint32_t page;      // página virtual mapeada
+    bool free;
+    PCB* owner;         // dono (acesso à entrada da tabela de páginas)
+
+    explicit Frame(uint32_t b)
+        : base(b), pid(-1), page(0), free(true), owner(nullptr) {}
+};
+
+// -------------------------------------------------------------
+//                           TLB
+// -------------------------------------------------------------
+// Associativa por conjunto (ways = entries → totalmente associativa),
+// substituição LRU dentro do conjunto. Entradas marcadas com o pid
+// (ASID), então trocas de contexto não exigem flush.
+class TLB {
+private:
+    struct Entry {
+        bool valid = false;
+        int pid = -1;
+        uint32_t vpn = 0;
+        uint32_t frame = 0;
+        uint64_t lastUse = 0;
+    };
+
+    size_t numSets;
+    size_t ways;
+    std::vector<Entry> entries;   // numSets * ways
+    uint64_t useClock;
+
+    uint64_t hits;
+    uint64_t misses;
+
+public:
+    TLB(size_t entries_ = 16, size_t ways_ = 4);
+
+    bool lookup(int pid, uint32_t vpn, uint32_t &frame);
+    void insert(int pid, uint32_t vpn, uint32_t frame);
+
+    void invalidate(int pid, uint32_t vpn);
+    void flushPid(int pid);
+    void flush();
+
+    uint64_t get_hits()   const { return hits; }
+    uint64_t get_misses() const { return misses; }
+};
+
+// -------------------------------------------------------------
+//              SUBSTITUIÇÃO DE PÁGINAS (sob demanda)
+// -------------------------------------------------------------
+enum class PageReplacementPolicy {
+    FIFO,          // ordem de carga
+    CLOCK,         // segunda chance com ponteiro circular
+    LRU_APPROX,    // aging: contador de 8 bits deslocado a cada período
+    WSCLOCK,       // clock + janela de working set (prefere páginas limpas)
+    WORKING_SET    // expulsa páginas fora da janela tau
+};
+
+// Escolhe o quadro vítima quando não há quadros livres. Lê e limpa
+// os bits R das entradas da tabela de páginas dos donos dos quadros.
+class PageReplacer {
+private:
+    PageReplacementPolicy policy;
+    uint64_t window;                 // tau (em ticks) para WS / WSClock
+    size_t hand;                     // ponteiro do Clock / WSClock
+    std::deque<uint32_t> loadOrder;  // FIFO
+    std::vector<uint8_t> age;        // contadores do aging (por quadro)
+
+    uint32_t selectFIFO(const std::vector<Frame> &frames);
+    uint32_t selectClock(const std::vector<Frame> &frames);
+    uint32_t selectAging(const std::vector<Frame> &frames);
+    uint32_t selectWSClock(const std::vector<Frame> &frames, uint64_t now);
+    uint32_t selectWorkingSet(const std::vector<Frame> &frames, uint64_t now);
+
+public:
+    PageReplacer(PageReplacementPolicy p = PageReplacementPolicy::CLOCK,
+                 uint64_t window_ = 50);
+
+    void reset(size_t numFrames);
+    void onLoad(uint32_t frame);
+    void onFree(uint32_t frame);
+
+    // Período do aging: desloca contadores e limpa bits R
+    void ageTick(const std::vector<Frame> &frames);
+
+    uint32_t selectVictim(const std::vector<Frame> &frames, uint64_t now);
+
+    PageReplacementPolicy getPolicy() const { return policy; }
+};
+
+#endif
@@ -1,4 +1,11 @@
 #include "SECONDARY_MEMORY.hpp"
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 SECONDARY_MEMORY::SECONDARY_MEMORY(size_t size) {
     if (size > MAX_SECONDARY_MEMORY_SIZE) {
@@ -7,15 +14,100 @@ SECONDARY_MEMORY::SECONDARY_MEMORY(size_t size) {
         this->size = size;
     }
     this->storage.resize(this->size, MEMORY_ACCESS_ERROR);
+    this->words = this->storage.data();
+}
+
+// --------------------------------------------------
+// Backend em arquivo esparso (mmap)
+// --------------------------------------------------
+// O arquivo é estendido com ftruncate (sem gravar nada), então só as
+// páginas realmente tocadas ocupam disco e RAM do host. Conteúdo de
+// execuções anteriores é preservado; páginas nunca escritas leem 0.
+SECONDARY_MEMORY::SECONDARY_MEMORY(size_t size, const std::string &backingFile)
+    : size(size)
+{
+    size_t bytes = size * sizeof(uint32_t);
+
+    fd = open(backingFile.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        std::cerr << "[SECONDARY_MEMORY] não foi possível abrir " << backingFile << "\n";
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0 ||
+            (static_cast<size_t>(st.st_size) < bytes && ftruncate(fd, bytes) != 0)) {
+            std::cerr << "[SECONDARY_MEMORY] ftruncate falhou: " << backingFile << "\n";
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    if (fd >= 0) {
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            std::cerr << "[SECONDARY_MEMORY] mmap falhou: " << backingFile << "\n";
+            close(fd);
+            fd = -1;
+        } else {
+            words = static_cast<uint32_t*>(p);
+            mappedBytes = bytes;
+            setAdvice(MADV_RANDOM);   // swap: acessos por página, sem ordem
+            return;
+        }
+    }
+
+    // Falhou: volta ao vetor limitado
+    this->size = size > MAX_SECONDARY_MEMORY_SIZE ? MAX_SECONDARY_MEMORY_SIZE : size;
+    this->storage.resize(this->size, MEMORY_ACCESS_ERROR);
+    this->words = this->storage.data();
 }
 
 SECONDARY_MEMORY::~SECONDARY_MEMORY() {
+    if (fd >= 0) {
+        munmap(words, mappedBytes);
+        close(fd);
+    }
     this->storage.clear();
 }
 
+void SECONDARY_MEMORY::sync() {
+    if (fd >= 0) msync(words, mappedBytes, MS_SYNC);
+}
+
+// --------------------------------------------------
+// madvise conforme o padrão observado: sequencial depois de
+// uma sequência de endereços consecutivos, aleatório depois de
+// vários saltos (com histerese para não chamar a cada acesso)
+// --------------------------------------------------
+void SECONDARY_MEMORY::setAdvice(int newAdvice) {
+    if (fd < 0 || newAdvice == advice) return;
+    madvise(words, mappedBytes, newAdvice);
+    advice = newAdvice;
+}
+
+void SECONDARY_MEMORY::trackAccess(uint32_t address) {
+    if (fd < 0) return;
+
+    if (address == lastAddress + 1) {
+        seqStreak++;
+        randomStreak = 0;
+    } else if (address != lastAddress) {
+        randomStreak++;
+        seqStreak = 0;
+    }
+    lastAddress = address;
+
+    if (seqStreak >= 64)       setAdvice(MADV_SEQUENTIAL);
+    else if (randomStreak >= 16) setAdvice(MADV_RANDOM);
+}
+
 // Simulação de acesso lento
 uint32_t SECONDARY_MEMORY::ReadMem(uint32_t address) {
     if (address < this->size) {
+        if (fd >= 0) {
+            trackAccess(address);
+            return words[address];
+        }
+
         // Varredura simulada: percorre o vetor para encontrar o endereço
         for (uint32_t i = 0; i < this->size; ++i) {
             if (i == address) {
@@ -29,6 +121,12 @@ uint32_t SECONDARY_MEMORY::ReadMem(uint32_t address) {
 // Simulação de acesso lento
 uint32_t SECONDARY_MEMORY::WriteMem(uint32_t address, uint32_t data) {
     if (address < this->size) {
+        if (fd >= 0) {
+            trackAccess(address);
+            words[address] = data;
+            return data;
+        }
+
         // Varredura simulada: percorre o vetor para encontrar o endereço
         for (uint32_t i = 0; i < this->size; ++i) {
             if (i == address) {
@@ -42,23 +140,46 @@ uint32_t SECONDARY_MEMORY::WriteMem(uint32_t address, uint32_t data) {
 
 uint32_t SECONDARY_MEMORY::DeleteData(uint32_t address) {
     if (address < this->size) {
-        uint32_t deletedData = storage[address];
-        storage[address] = MEMORY_ACCESS_ERROR;
+        uint32_t deletedData = words[address];
+        words[address] = MEMORY_ACCESS_ERROR;
         return deletedData;
     }
     return MEMORY_ACCESS_ERROR;
 }
 
 bool SECONDARY_MEMORY::isEmpty() {
-    for (const auto &val : storage) {
-        if (val != MEMORY_ACCESS_ERROR) return false;
+    for (size_t i = 0; i < size; i++) {
+        if (words[i] != MEMORY_ACCESS_ERROR) return false;
     }
     return true;
 }
 
 bool SECONDARY_MEMORY::notFull() {
-    for (const auto &val : storage) {
-        if (val == MEMORY_ACCESS_ERROR) return true;
+    for (size_t i = 0; i < size; i++) {
+        if (words[i] == MEMORY_ACCESS_ERROR) return true;
     }
     return false;
-}
\ No newline at end of file
+}
+
+bool SECONDARY_MEMORY::WriteBlock(uint32_t address, const uint32_t* src, size_t count) {
+    if (address > this->size || count > this->size - address) return false;
+    if (count > 0)
+        std::memcpy(words + address, src, count * sizeof(uint32_t));
+    return true;
+}
+
+bool SECONDARY_MEMORY::ReadBlock(uint32_t address, uint32_t* dst, size_t count) {
+    if (address > this->size || count > this->size - address) return false;
+    if (count == 0) return true;
+
+    if (fd >= 0) {
+        // Página(s) do swap serão lidas inteiras: pede read-ahead
+        uintptr_t pageMask = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE)) - 1;
+        uintptr_t begin = reinterpret_cast<uintptr_t>(words + address) & ~pageMask;
+        uintptr_t end = reinterpret_cast<uintptr_t>(words + address + count);
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+    }
+
+    std::memcpy(dst, words + address, count * sizeof(uint32_t));
+    return true;
+}
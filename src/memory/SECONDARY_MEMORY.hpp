@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <vector>
 #include <cstddef>
+#include <string>
 
 #define MEMORY_ACCESS_ERROR UINT32_MAX
 #define MAX_SECONDARY_MEMORY_SIZE 8192
@@ -12,20 +13,50 @@ using std::size_t;
 using std::uint32_t;
 using std::vector;
 
+// Memória secundária em um vetor (limitada a MAX_SECONDARY_MEMORY_SIZE)
+// ou em um arquivo esparso mapeado com mmap: pode ter gigabytes, só
+// ocupa RAM do host nas páginas tocadas e persiste entre execuções.
 class SECONDARY_MEMORY {
 private:
     size_t size;
     vector<uint32_t> storage; // Alterado para um vetor simples
 
+    // Backend em arquivo (fd < 0 = vetor)
+    uint32_t* words = nullptr;   // storage.data() ou a região mapeada
+    int fd = -1;
+    size_t mappedBytes = 0;
+
+    // Padrão de acesso → dica de madvise
+    uint32_t lastAddress = 0;
+    uint32_t seqStreak = 0;
+    uint32_t randomStreak = 0;
+    int advice = -1;
+
+    void trackAccess(uint32_t address);
+    void setAdvice(int newAdvice);
+
     bool notFull();
     bool isEmpty();
 
 public:
     SECONDARY_MEMORY(size_t size);
+    SECONDARY_MEMORY(size_t size, const std::string &backingFile);
     ~SECONDARY_MEMORY();
+
+    SECONDARY_MEMORY(const SECONDARY_MEMORY&) = delete;
+    SECONDARY_MEMORY& operator=(const SECONDARY_MEMORY&) = delete;
+
     uint32_t ReadMem(uint32_t address);
     uint32_t WriteMem(uint32_t address, uint32_t data);
     uint32_t DeleteData(uint32_t address);
+
+    // Transferência em bloco (sem a varredura simulada)
+    bool WriteBlock(uint32_t address, const uint32_t* src, size_t count);
+    bool ReadBlock(uint32_t address, uint32_t* dst, size_t count);
+
+    bool isFileBacked() const { return fd >= 0; }
+    size_t getSize() const { return size; }
+    void sync();   // msync da região mapeada
 };
 
 #endif
\ No newline at end of file
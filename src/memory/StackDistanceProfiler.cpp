@@ -0,0 +1,112 @@
+#include "StackDistanceProfiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+StackDistanceProfiler::StackDistanceProfiler(size_t initialCapacity)
+    : tree(std::max<size_t>(initialCapacity, 16) + 1, 0),
+      clock(1),
+      coldAccesses(0),
+      totalAccesses(0)
+{
+}
+
+// --------------------------------------------------
+// Fenwick tree
+// --------------------------------------------------
+void StackDistanceProfiler::fenwickAdd(uint64_t pos, int32_t delta) {
+    for (; pos < tree.size(); pos += pos & (~pos + 1))
+        tree[pos] += delta;
+}
+
+uint64_t StackDistanceProfiler::fenwickSum(uint64_t pos) const {
+    uint64_t s = 0;
+    for (; pos > 0; pos -= pos & (~pos + 1))
+        s += tree[pos];
+    return s;
+}
+
+// --------------------------------------------------
+// COMPACT — renumera os instantes vivos quando o relógio
+// chega ao fim da árvore (custo amortizado O(log n))
+// --------------------------------------------------
+void StackDistanceProfiler::compact() {
+    std::vector<std::pair<uint64_t, uint32_t>> live;
+    live.reserve(lastAccess.size());
+    for (auto &kv : lastAccess)
+        live.emplace_back(kv.second, kv.first);
+    std::sort(live.begin(), live.end());
+
+    size_t newSize = std::max(tree.size() - 1, live.size() * 2) + 1;
+    tree.assign(newSize, 0);
+
+    clock = 1;
+    for (auto &e : live) {
+        lastAccess[e.second] = clock;
+        fenwickAdd(clock, 1);
+        clock++;
+    }
+}
+
+// --------------------------------------------------
+// ACCESS
+// --------------------------------------------------
+void StackDistanceProfiler::access(uint32_t address) {
+
+    if (clock >= tree.size()) compact();
+
+    totalAccesses++;
+
+    auto it = lastAccess.find(address);
+    if (it == lastAccess.end()) {
+        coldAccesses++;
+        lastAccess.emplace(address, clock);
+    } else {
+        uint64_t prev = it->second;
+        uint64_t distance = fenwickSum(clock - 1) - fenwickSum(prev);
+
+        if (histogram.size() <= distance) histogram.resize(distance + 1, 0);
+        histogram[distance]++;
+
+        fenwickAdd(prev, -1);
+        it->second = clock;
+    }
+
+    fenwickAdd(clock, 1);
+    clock++;
+}
+
+// --------------------------------------------------
+// Curva de hits
+// --------------------------------------------------
+uint64_t StackDistanceProfiler::hitsForCapacity(size_t capacity) const {
+    uint64_t hits = 0;
+    size_t limit = std::min(capacity, histogram.size());
+    for (size_t d = 0; d < limit; d++)
+        hits += histogram[d];
+    return hits;
+}
+
+void StackDistanceProfiler::saveMissRatioCSV(const std::string& filename) const {
+    std::ofstream fout(filename);
+    fout << "capacity,hits,misses,hit_rate,miss_ratio\n";
+
+    size_t maxCap = std::max<size_t>(lastAccess.size(), 1);
+    uint64_t hits = 0;
+
+    for (size_t c = 1; c <= maxCap; c++) {
+        if (c - 1 < histogram.size()) hits += histogram[c - 1];
+        uint64_t misses = totalAccesses - hits;
+
+        double hitRate = totalAccesses ? (double)hits / totalAccesses : 0.0;
+        fout << c << ","
+             << hits << ","
+             << misses << ","
+             << std::fixed << std::setprecision(6) << hitRate << ","
+             << (totalAccesses ? 1.0 - hitRate : 0.0) << "\n";
+    }
+}
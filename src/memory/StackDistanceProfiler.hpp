@@ -0,0 +1,54 @@
+#ifndef STACK_DISTANCE_PROFILER_HPP
+#define STACK_DISTANCE_PROFILER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// -------------------------------------------------------------
+//           STACK DISTANCE (MATTSON) PROFILER
+// -------------------------------------------------------------
+// Calcula a distância de reuso LRU de cada acesso numa única
+// passada. Uma árvore de Fenwick marca o instante do último acesso
+// de cada endereço; a distância é o número de marcas entre o último
+// acesso e o atual (endereços distintos tocados nesse intervalo).
+// Um acesso com distância d acerta em qualquer cache LRU totalmente
+// associativa com capacidade > d, então o histograma gera a curva
+// de hit/miss para TODAS as capacidades de uma vez.
+class StackDistanceProfiler {
+private:
+    // Fenwick tree (1-indexada) sobre os instantes de acesso
+    std::vector<uint32_t> tree;
+    uint64_t clock;   // próximo instante livre (1..tree.size()-1)
+
+    std::unordered_map<uint32_t, uint64_t> lastAccess; // endereço → instante
+
+    std::vector<uint64_t> histogram; // histogram[d] = acessos com distância d
+    uint64_t coldAccesses;           // primeira referência (distância infinita)
+    uint64_t totalAccesses;
+
+    void fenwickAdd(uint64_t pos, int32_t delta);
+    uint64_t fenwickSum(uint64_t pos) const;
+    void compact();
+
+public:
+    explicit StackDistanceProfiler(size_t initialCapacity = 1 << 16);
+
+    void access(uint32_t address);
+
+    // Hits de uma cache LRU totalmente associativa de 'capacity' linhas
+    uint64_t hitsForCapacity(size_t capacity) const;
+
+    uint64_t get_totalAccesses() const { return totalAccesses; }
+    uint64_t get_coldAccesses()  const { return coldAccesses; }
+    size_t   get_distinctAddresses() const { return lastAccess.size(); }
+    const std::vector<uint64_t>& getHistogram() const { return histogram; }
+
+    // capacity,hits,misses,hit_rate,miss_ratio — de 1 até o nº de
+    // endereços distintos (a partir daí só restam misses compulsórios)
+    void saveMissRatioCSV(const std::string& filename) const;
+};
+
+#endif
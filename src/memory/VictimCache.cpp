@@ -0,0 +1,95 @@
+#include "VictimCache.hpp"
+#include "MemoryManager.hpp"
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+VictimCache::VictimCache(size_t capacity_)
+    : capacity(capacity_), hits(0), misses(0), insertions(0)
+{
+}
+
+// --------------------------------------------------
+// INSERT (linha expulsa da L1)
+// --------------------------------------------------
+void VictimCache::insert(uint32_t address, uint32_t data, bool dirty,
+                         MemoryManager* memManager)
+{
+    auto it = lines.find(address);
+    if (it != lines.end()) {
+        it->second->data = data;
+        it->second->isDirty = it->second->isDirty || dirty;
+        lru_list.splice(lru_list.end(), lru_list, it->second);
+        return;
+    }
+
+    if (lines.size() >= capacity) {
+        Line victim = lru_list.front();
+        lru_list.pop_front();
+        lines.erase(victim.address);
+
+        if (victim.isDirty)
+            memManager->writeBack(victim.address, victim.data);
+    }
+
+    lru_list.push_back({address, data, dirty});
+    lines[address] = std::prev(lru_list.end());
+    insertions++;
+}
+
+// --------------------------------------------------
+// TAKE (hit → linha sai daqui e volta para a L1)
+// --------------------------------------------------
+bool VictimCache::take(uint32_t address, uint32_t &data, bool &dirty) {
+    auto it = lines.find(address);
+    if (it == lines.end()) {
+        misses++;
+        return false;
+    }
+
+    data  = it->second->data;
+    dirty = it->second->isDirty;
+
+    lru_list.erase(it->second);
+    lines.erase(it);
+    hits++;
+    return true;
+}
+
+// --------------------------------------------------
+// UPDATE
+// --------------------------------------------------
+void VictimCache::update(uint32_t address, uint32_t data) {
+    auto it = lines.find(address);
+    if (it != lines.end())
+        it->second->data = data;
+}
+
+// --------------------------------------------------
+// FLUSH / INVALIDATE
+// --------------------------------------------------
+void VictimCache::flush(MemoryManager* memManager) {
+    for (auto &l : lru_list) {
+        if (l.isDirty) {
+            memManager->writeToFile(l.address, l.data);
+            l.isDirty = false;
+        }
+    }
+}
+
+void VictimCache::removeRange(uint32_t lo, uint32_t hi,
+                              std::vector<std::pair<uint32_t, uint32_t>> &dirtyOut)
+{
+    for (auto it = lru_list.begin(); it != lru_list.end(); ) {
+        if (it->address < lo || it->address >= hi) { ++it; continue; }
+
+        if (it->isDirty) dirtyOut.emplace_back(it->address, it->data);
+        lines.erase(it->address);
+        it = lru_list.erase(it);
+    }
+}
+
+void VictimCache::invalidate() {
+    lru_list.clear();
+    lines.clear();
+}
@@ -0,0 +1,64 @@
+#ifndef VICTIM_CACHE_HPP
+#define VICTIM_CACHE_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <utility>
+
+class MemoryManager;
+
+// -------------------------------------------------------------
+//                     VICTIM CACHE
+// -------------------------------------------------------------
+// Pequena cache totalmente associativa (LRU) entre a L1 e a RAM.
+// Recebe toda linha expulsa da L1; num miss da L1 a linha é
+// procurada aqui e, se encontrada, volta para a L1 (swap).
+// Linhas sujas expulsas daqui seguem para o write buffer.
+class VictimCache {
+private:
+    struct Line {
+        uint32_t address;
+        uint32_t data;
+        bool isDirty;
+    };
+
+    size_t capacity;
+
+    std::list<Line> lru_list;   // front = menos recente
+    std::unordered_map<uint32_t, std::list<Line>::iterator> lines;
+
+    // Métricas
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+
+public:
+    explicit VictimCache(size_t capacity_ = 0);
+
+    bool enabled() const { return capacity > 0; }
+    size_t size() const { return lines.size(); }
+
+    // Insere linha expulsa da L1 (pode expulsar a LRU daqui)
+    void insert(uint32_t address, uint32_t data, bool dirty, MemoryManager* memManager);
+
+    // Procura e REMOVE a linha (ela volta para a L1)
+    bool take(uint32_t address, uint32_t &data, bool &dirty);
+
+    // Atualiza valor de uma linha presente (write-through sem alocação)
+    void update(uint32_t address, uint32_t data);
+
+    void flush(MemoryManager* memManager);
+    // Remove as linhas em [lo, hi) sem contar hit/miss
+    void removeRange(uint32_t lo, uint32_t hi,
+                     std::vector<std::pair<uint32_t, uint32_t>> &dirtyOut);
+    void invalidate();
+
+    uint64_t get_hits()       const { return hits; }
+    uint64_t get_misses()     const { return misses; }
+    uint64_t get_insertions() const { return insertions; }
+};
+
+#endif
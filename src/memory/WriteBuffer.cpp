@@ -0,0 +1,79 @@
+#include "WriteBuffer.hpp"
+#include "MemoryManager.hpp"
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+WriteBuffer::WriteBuffer(size_t capacity_, uint64_t drainInterval_)
+    : capacity(capacity_),
+      drainInterval(drainInterval_ == 0 ? 1 : drainInterval_),
+      cyclesSinceDrain(0),
+      inserted(0), coalesced(0), drained(0), fullStalls(0)
+{
+}
+
+// --------------------------------------------------
+// PUSH (com coalescência)
+// --------------------------------------------------
+bool WriteBuffer::push(uint32_t address, uint32_t data) {
+    for (auto &e : entries) {
+        if (e.address == address) {
+            e.data = data;
+            coalesced++;
+            return true;
+        }
+    }
+
+    if (full()) return false;
+
+    entries.push_back({address, data});
+    inserted++;
+    return true;
+}
+
+// --------------------------------------------------
+// LOOKUP (store → load forwarding)
+// --------------------------------------------------
+bool WriteBuffer::lookup(uint32_t address, uint32_t &data) const {
+    for (const auto &e : entries) {
+        if (e.address == address) {
+            data = e.data;
+            return true;
+        }
+    }
+    return false;
+}
+
+// --------------------------------------------------
+// DRENAGEM
+// --------------------------------------------------
+bool WriteBuffer::drainOne(MemoryManager* memManager) {
+    if (entries.empty()) return false;
+
+    Entry e = entries.front();
+    entries.pop_front();
+
+    memManager->drainWrite(e.address, e.data);
+    drained++;
+    return true;
+}
+
+void WriteBuffer::drainAll(MemoryManager* memManager) {
+    while (drainOne(memManager)) {}
+    cyclesSinceDrain = 0;
+}
+
+// --------------------------------------------------
+// TICK — 1 entrada a cada drainInterval ciclos
+// --------------------------------------------------
+void WriteBuffer::tick(MemoryManager* memManager) {
+    if (entries.empty()) {
+        cyclesSinceDrain = 0;
+        return;
+    }
+
+    if (++cyclesSinceDrain >= drainInterval) {
+        drainOne(memManager);
+        cyclesSinceDrain = 0;
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef WRITE_BUFFER_HPP
+#define WRITE_BUFFER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+
+class MemoryManager;
+
+// -------------------------------------------------------------
+//                     WRITE BUFFER
+// -------------------------------------------------------------
+// Fila limitada de escritas pendentes entre a cache e a memória.
+// - Escritas para um endereço já presente são coalescidas (só o
+//   valor mais novo vai para a memória).
+// - A drenagem acontece em segundo plano: uma entrada a cada
+//   drainInterval ciclos simulados (MemoryManager::tick).
+// - Com o buffer cheio, a entrada mais antiga é drenada de forma
+//   síncrona e o custo vira stall para o processo que escreveu.
+class WriteBuffer {
+private:
+    struct Entry {
+        uint32_t address;
+        uint32_t data;
+    };
+
+    size_t capacity;
+    uint64_t drainInterval;
+    uint64_t cyclesSinceDrain;
+
+    std::deque<Entry> entries;
+
+    // Métricas
+    uint64_t inserted;
+    uint64_t coalesced;
+    uint64_t drained;
+    uint64_t fullStalls;
+
+public:
+    WriteBuffer(size_t capacity_ = 8, uint64_t drainInterval_ = 5);
+
+    bool enabled() const { return capacity > 0; }
+    bool empty() const { return entries.empty(); }
+    bool full() const { return entries.size() >= capacity; }
+    size_t size() const { return entries.size(); }
+
+    // Insere (ou coalesce) uma escrita. Retorna false se o buffer
+    // estiver cheio e a escrita não puder ser absorvida.
+    bool push(uint32_t address, uint32_t data);
+
+    // Encaminhamento store→load: devolve o valor pendente, se houver
+    bool lookup(uint32_t address, uint32_t &data) const;
+
+    // Drena a entrada mais antiga para a memória
+    bool drainOne(MemoryManager* memManager);
+    void drainAll(MemoryManager* memManager);
+
+    // Avança 1 ciclo simulado (drenagem em segundo plano)
+    void tick(MemoryManager* memManager);
+
+    void recordStall() { fullStalls++; }
+
+    uint64_t get_inserted()   const { return inserted; }
+    uint64_t get_coalesced()  const { return coalesced; }
+    uint64_t get_drained()    const { return drained; }
+    uint64_t get_fullStalls() const { return fullStalls; }
+};
+
+#endif
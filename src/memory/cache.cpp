@@ -10,7 +10,7 @@
 // Construtor
 // --------------------------------------------------
 Cache::Cache(size_t capacity_, CachePolicyType p)
-    : capacity(capacity_), policy(p), cache_hits(0), cache_misses(0)
+    : capacity(capacity_), policy(p), cache_hits(0), cache_misses(0), cache_evictions(0)
 {
 }
 
@@ -38,17 +38,17 @@ void Cache::evictEntry(MemoryManager* memManager) {
     auto it = cacheMap.find(addr_to_remove);
     if (it != cacheMap.end()) {
 
-        // Write-back se sujo
-        if (it->second.isDirty) {
-            try {
-                memManager->writeToFile(addr_to_remove, it->second.data);
-            } catch (...) {
-                std::cerr << "[Cache] ERRO: writeBack falhou em addr "
-                          << addr_to_remove << std::endl;
-            }
+        // Vítima segue para o MemoryManager: victim cache (se houver)
+        // ou write-back via write buffer quando suja
+        try {
+            memManager->evictFromL1(addr_to_remove, it->second.data, it->second.isDirty);
+        } catch (...) {
+            std::cerr << "[Cache] ERRO: writeBack falhou em addr "
+                      << addr_to_remove << std::endl;
         }
 
         cacheMap.erase(it);
+        cache_evictions++;
     }
 }
 
@@ -78,13 +78,13 @@ size_t Cache::get(size_t address) {
 // --------------------------------------------------
 // PUT
 // --------------------------------------------------
-void Cache::put(size_t address, size_t data, MemoryManager* memManager) {
+void Cache::put(size_t address, size_t data, MemoryManager* memManager, bool dirty) {
 
     // Já existe → apenas atualiza (não conta reposição)
     if (cacheMap.find(address) != cacheMap.end()) {
         cacheMap[address].data = data;
         cacheMap[address].isValid = true;
-        cacheMap[address].isDirty = false;
+        cacheMap[address].isDirty = dirty;
 
         if (policy == CachePolicyType::LRU) {
             auto pos = lru_pos[address];
@@ -105,7 +105,7 @@ void Cache::put(size_t address, size_t data, MemoryManager* memManager) {
     CacheEntry e;
     e.data = data;
     e.isValid = true;
-    e.isDirty = false;
+    e.isDirty = dirty;
 
     cacheMap.emplace(address, e);
 
@@ -119,9 +119,9 @@ void Cache::put(size_t address, size_t data, MemoryManager* memManager) {
 }
 
 // --------------------------------------------------
-// UPDATE (write-back parcial)
+// UPDATE (dirty=false em write-through: memória já recebe o valor)
 // --------------------------------------------------
-void Cache::update(size_t address, size_t data) {
+void Cache::update(size_t address, size_t data, bool dirty) {
     auto it = cacheMap.find(address);
     if (it == cacheMap.end()) {
         // no-write-allocate
@@ -129,7 +129,7 @@ void Cache::update(size_t address, size_t data) {
     }
 
     it->second.data = data;
-    it->second.isDirty = true;
+    it->second.isDirty = it->second.isDirty || dirty;
 
     // Atualiza ordem LRU
     if (policy == CachePolicyType::LRU) {
@@ -140,6 +140,40 @@ void Cache::update(size_t address, size_t data) {
     }
 }
 
+// --------------------------------------------------
+// REMOVE RANGE — O(linhas da cache), não O(tamanho da faixa)
+// --------------------------------------------------
+void Cache::removeRange(size_t lo, size_t hi,
+                        std::vector<std::pair<size_t, size_t>> &dirtyOut)
+{
+    bool removed = false;
+
+    for (auto it = cacheMap.begin(); it != cacheMap.end(); ) {
+        if (it->first < lo || it->first >= hi) { ++it; continue; }
+
+        if (it->second.isDirty)
+            dirtyOut.emplace_back(it->first, it->second.data);
+
+        if (policy == CachePolicyType::LRU) {
+            lru_list.erase(lru_pos[it->first]);
+            lru_pos.erase(it->first);
+        }
+        it = cacheMap.erase(it);
+        removed = true;
+    }
+
+    if (removed && policy == CachePolicyType::FIFO) {
+        // std::queue não remove do meio: reconstrói sem a faixa
+        std::queue<size_t> rest;
+        while (!fifo_queue.empty()) {
+            size_t a = fifo_queue.front();
+            if (a < lo || a >= hi) rest.push(a);
+            fifo_queue.pop();
+        }
+        fifo_queue.swap(rest);
+    }
+}
+
 // --------------------------------------------------
 // INVALIDAR TODA CACHE
 // --------------------------------------------------
@@ -165,7 +199,3 @@ std::vector<std::pair<size_t, size_t>> Cache::dirtyData() {
 
     return out;
 }
-
-// --------------------------------------------------
-int Cache::get_hits()  { return cache_hits; }
-int Cache::get_misses(){ return cache_misses; }
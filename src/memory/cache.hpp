@@ -6,6 +6,7 @@
 #include <list>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 
 #include "constants.hpp"
 
@@ -16,6 +17,13 @@ enum class CachePolicyType {
     FIFO,
     LRU
 };
+
+// Política de escrita usada pelo MemoryManager
+enum class WritePolicy {
+    WRITE_THROUGH,  // write-through / no-write-allocate
+    WRITE_BACK      // write-back / write-allocate
+};
+
 struct CacheEntry {
     size_t data = 0;
     bool isValid = false;
@@ -37,9 +45,10 @@ private:
     std::list<size_t> lru_list;  
     std::unordered_map<size_t, std::list<size_t>::iterator> lru_pos;
 
-    // Métricas
-    int cache_hits;
-    int cache_misses;
+    // Métricas (64 bits: execuções longas estouravam int)
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t cache_evictions;
 
     void evictEntry(MemoryManager* memManager);
 
@@ -48,13 +57,18 @@ public:
     ~Cache();
 
     size_t get(size_t address);
-    void put(size_t address, size_t data, MemoryManager* memManager);
-    void update(size_t address, size_t data);
+    void put(size_t address, size_t data, MemoryManager* memManager, bool dirty = false);
+    void update(size_t address, size_t data, bool dirty = true);
+    // Remove as linhas em [lo, hi) (quadro reaproveitado, DMA,
+    // relocação); as sujas são devolvidas em dirtyOut
+    void removeRange(size_t lo, size_t hi,
+                     std::vector<std::pair<size_t, size_t>> &dirtyOut);
     void invalidate();
     std::vector<std::pair<size_t, size_t>> dirtyData();
 
-    int get_hits();
-    int get_misses();
+    uint64_t get_hits() const { return cache_hits; }
+    uint64_t get_misses() const { return cache_misses; }
+    uint64_t get_evictions() const { return cache_evictions; }
 };
 
 #endif
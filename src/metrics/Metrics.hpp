@@ -1,6 +1,7 @@
 #ifndef METRICS_HPP
 #define METRICS_HPP
 
+#include <array>
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -9,6 +10,7 @@
 #include <iomanip>
 #include "../cpu/PCB.hpp"
 #include "../multicore/Core.hpp"
+#include "../memory/MemoryBus.hpp"
 
 class Metrics {
 
@@ -33,8 +35,41 @@ public:
         // memória
         uint64_t cache_hits;
         uint64_t cache_misses;
+        uint64_t miss_compulsory;
+        uint64_t miss_capacity;
+        uint64_t miss_conflict;
+        uint64_t victim_hits;
         uint64_t mem_accesses;
+        uint64_t memory_cycles;
+        uint64_t write_stall_cycles;
+        uint64_t bus_wait_cycles;
+        uint64_t numa_local;
+        uint64_t numa_remote;
+        uint64_t branches;
+        uint64_t branch_mispredictions;
+        uint64_t branch_flush_cycles;
+        uint64_t stall_load_use;
+        uint64_t stall_raw;
+        uint64_t forwards_ex_mem;
+        uint64_t forwards_mem_wb;
+        uint64_t tlb_hits;
+        uint64_t tlb_misses;
+        uint64_t page_faults;
+        uint64_t page_fault_cycles;
         uint64_t io_cycles;
+        uint64_t context_switches;
+        uint64_t context_switch_cycles;
+        uint64_t switch_drain_cycles;
+        uint64_t warmup_cycles;
+        uint64_t traps;
+        uint64_t interrupt_cycles;
+
+        // Perfil de instruções (só com PCB::profile ligado): mix por
+        // classe, blocos básicos e PCs do mais caro para o mais barato
+        bool profiled;
+        std::array<uint64_t, INSTR_CLASS_COUNT> instr_mix;
+        std::vector<InstructionProfile::Block> hot_blocks;
+        std::vector<InstructionProfile::PcCount> hot_pcs;
     };
 
     // ============================================================
@@ -43,9 +78,73 @@ public:
     struct CoreReport {
         int coreId = -1;
 
+        // Perfil (cores heterogêneos): clock relativo e potência
+        std::string profile;
+        double clock = 1.0;
+        double power = 1.0;
+        double energy = 0.0;             // potência × ticks executando
+
+        // Modelo de energia/DVFS (nJ; só com EnergyConfig::enabled)
+        bool energy_model = false;
+        EnergyMeter::Stats energy_stats;
+        std::vector<DvfsLevel> dvfs_levels;
+        std::string governor;
+
         uint64_t running_time = 0;
         uint64_t waiting_io_time = 0;
         uint64_t idle_time = 0;
+
+        // Barramento de memória (0 sem modelo de contenção)
+        uint64_t bus_requests = 0;
+        uint64_t bus_wait_cycles = 0;
+        uint64_t row_hits = 0;
+        uint64_t row_misses = 0;
+
+        // Despacho (IPC = instruções / tempo executando)
+        int issue_width = 1;
+        uint64_t instructions = 0;
+        double ipc = 0.0;
+        uint64_t cut_dependency = 0;
+        uint64_t cut_alu = 0;
+        uint64_t cut_mem = 0;
+
+        // Backend fora de ordem (só com OutOfOrderConfig::enabled)
+        bool out_of_order = false;
+        double rob_avg = 0.0;
+        uint64_t rob_full = 0;
+        uint64_t rs_full = 0;
+        uint64_t lsq_full = 0;
+        uint64_t squashed = 0;
+        uint64_t store_forwards = 0;
+        uint64_t load_latency = 0;
+        uint64_t head_mem_stall = 0;   // latência de load que o ROB não escondeu
+
+        // Trocas de contexto (ciclos: salvar/restaurar, drenagem, warm-up)
+        uint64_t context_switches = 0;
+        uint64_t switch_cycles = 0;
+        uint64_t drain_cycles = 0;
+        uint64_t warmup_cycles = 0;
+
+        // Interrupções (só com o InterruptController)
+        bool interrupts = false;
+        InterruptController::CoreStats irq;
+
+        // SMT: uso dos slots de despacho e de cada contexto de hardware
+        double issue_utilization = 0.0;
+        std::vector<Core::ContextStats> contexts;
+    };
+
+    // ============================================================
+    //          RELATÓRIO GLOBAL DA HIERARQUIA DE CACHE
+    // ============================================================
+    struct CacheReport {
+        uint64_t l1_hits = 0;
+        uint64_t l1_misses = 0;
+        uint64_t miss_compulsory = 0;
+        uint64_t miss_capacity = 0;
+        uint64_t miss_conflict = 0;
+        uint64_t victim_hits = 0;
+        uint64_t victim_misses = 0;
     };
 
     // ============================================================
@@ -74,8 +173,41 @@ public:
 
             r.cache_hits   = p->cache_hits.load();
             r.cache_misses = p->cache_misses.load();
+            r.miss_compulsory = p->miss_compulsory.load();
+            r.miss_capacity   = p->miss_capacity.load();
+            r.miss_conflict   = p->miss_conflict.load();
+            r.victim_hits     = p->victim_hits.load();
             r.mem_accesses = p->mem_accesses_total.load();
+            r.memory_cycles = p->memory_cycles.load();
+            r.write_stall_cycles = p->write_stall_cycles.load();
+            r.bus_wait_cycles = p->bus_wait_cycles.load();
+            r.numa_local   = p->numa_local_accesses.load();
+            r.numa_remote  = p->numa_remote_accesses.load();
+            r.branches     = p->branches.load();
+            r.branch_mispredictions = p->branch_mispredictions.load();
+            r.branch_flush_cycles   = p->branch_flush_cycles.load();
+            r.stall_load_use  = p->stall_load_use_cycles.load();
+            r.stall_raw       = p->stall_raw_cycles.load();
+            r.forwards_ex_mem = p->forwards_ex_mem.load();
+            r.forwards_mem_wb = p->forwards_mem_wb.load();
+            r.tlb_hits     = p->tlb_hits.load();
+            r.tlb_misses   = p->tlb_misses.load();
+            r.page_faults  = p->page_faults.load();
+            r.page_fault_cycles = p->page_fault_cycles.load();
             r.io_cycles    = p->io_cycles.load();
+            r.context_switches      = p->context_switches.load();
+            r.context_switch_cycles = p->context_switch_cycles.load();
+            r.switch_drain_cycles   = p->switch_drain_cycles.load();
+            r.warmup_cycles         = p->warmup_cycles.load();
+            r.traps                 = p->traps.load();
+            r.interrupt_cycles      = p->interrupt_cycles.load();
+
+            r.profiled = p->profile.enabled();
+            if (r.profiled) {
+                r.instr_mix  = p->profile.getMix();
+                r.hot_blocks = p->profile.hotBlocks();
+                r.hot_pcs    = p->profile.hotPcs();
+            }
 
             reports.push_back(r);
         }
@@ -86,7 +218,9 @@ public:
     // ============================================================
     //         COLETA DE MÉTRICAS DOS CORES
     // ============================================================
-    static std::vector<CoreReport> collectCores(const std::vector<std::unique_ptr<Core>>& cores)
+    static std::vector<CoreReport> collectCores(const std::vector<std::unique_ptr<Core>>& cores,
+                                                const MemoryBus* bus = nullptr,
+                                                const InterruptController* irq = nullptr)
     {
         std::vector<CoreReport> R;
         R.reserve(cores.size());
@@ -96,16 +230,89 @@ public:
             CoreReport r;
 
             r.coreId = c->getId();
+            r.profile          = c->getProfile().name;
+            r.clock            = c->getProfile().clock;
+            r.power            = c->getProfile().power;
+            r.energy           = c->getEnergy();
+            if (c->getEnergyMeter().enabled()) {
+                r.energy_model = true;
+                r.energy_stats = c->getEnergyMeter().getStats();
+                r.dvfs_levels  = c->getEnergyMeter().getConfig().levels;
+                r.governor     = governorName(c->getEnergyMeter().getConfig().governor);
+            }
             r.running_time     = c->time_running;
             r.waiting_io_time  = c->time_waiting_io;
             r.idle_time        = c->time_idle;
 
+            r.issue_width    = c->getIssueConfig().width;
+            r.instructions   = c->instructions_executed;
+            r.ipc            = c->getIPC();
+            r.cut_dependency = c->issue_cut_dependency;
+            r.cut_alu        = c->issue_cut_alu;
+            r.cut_mem        = c->issue_cut_mem;
+            r.issue_utilization = c->getIssueUtilization();
+            r.contexts       = c->getContextStats();
+            r.context_switches = c->context_switches;
+            r.switch_cycles    = c->switch_cycles;
+            r.drain_cycles     = c->drain_cycles;
+            r.warmup_cycles    = c->warmup_cycles;
+            if (irq && static_cast<size_t>(r.coreId) < irq->getStats().size()) {
+                r.interrupts = true;
+                r.irq        = irq->getStats()[r.coreId];
+            }
+
+            if (c->isOutOfOrder()) {
+                const auto s = c->getOutOfOrderStats();
+                r.out_of_order   = true;
+                r.rob_avg        = s.cycles ? static_cast<double>(s.robOccupancy) / s.cycles : 0.0;
+                r.rob_full       = s.robFullCycles;
+                r.rs_full        = s.rsFullCycles;
+                r.lsq_full       = s.lsqFullCycles;
+                r.squashed       = s.squashed;
+                r.store_forwards = s.storeForwards;
+                r.load_latency   = s.loadLatency;
+                r.head_mem_stall = s.headMemStallCycles;
+            }
+
+            if (bus && static_cast<size_t>(r.coreId) < bus->get_coreStats().size()) {
+                const auto &b = bus->get_coreStats()[r.coreId];
+                r.bus_requests    = b.requests;
+                r.bus_wait_cycles = b.queueCycles;
+                r.row_hits        = b.rowHits;
+                r.row_misses      = b.rowMisses;
+            }
+
             R.push_back(r);
         }
 
         return R;
     }
 
+    // ============================================================
+    //         COLETA DE MÉTRICAS GLOBAIS DA CACHE
+    // ============================================================
+    static CacheReport collectCache(const std::vector<PCBReport>& R,
+                                    const MemoryManager& memory)
+    {
+        CacheReport c;
+
+        for (auto& r : R) {
+            c.l1_hits   += r.cache_hits;
+            c.l1_misses += r.cache_misses;
+        }
+
+        const MissClassifier& mc = memory.getMissClassifier();
+        c.miss_compulsory = mc.get_compulsory();
+        c.miss_capacity   = mc.get_capacity();
+        c.miss_conflict   = mc.get_conflict();
+
+        const VictimCache& vc = memory.getVictimCache();
+        c.victim_hits   = vc.get_hits();
+        c.victim_misses = vc.get_misses();
+
+        return c;
+    }
+
     // ============================================================
     //                 PRINT MÉTRICAS PCB
     // ============================================================
@@ -121,9 +328,45 @@ public:
             std::cout << "  Response     : " << r.response << "\n";
             std::cout << "  Pipeline cyc.: " << r.pipeline_cycles << "\n";
             std::cout << "  Cache hits   : " << r.cache_hits << "\n";
-            std::cout << "  Cache misses : " << r.cache_misses << "\n";
+            std::cout << "  Cache misses : " << r.cache_misses
+                      << " (comp " << r.miss_compulsory
+                      << " / cap " << r.miss_capacity
+                      << " / conf " << r.miss_conflict << ")\n";
+            std::cout << "  Victim hits  : " << r.victim_hits << "\n";
             std::cout << "  Mem access   : " << r.mem_accesses << "\n";
+            std::cout << "  Mem cycles   : " << r.memory_cycles << "\n";
+            std::cout << "  Write stalls : " << r.write_stall_cycles << "\n";
+            std::cout << "  Bus wait     : " << r.bus_wait_cycles << "\n";
+            std::cout << "  NUMA loc/rem : " << r.numa_local << " / " << r.numa_remote << "\n";
+            std::cout << "  Branches     : " << r.branches
+                      << " (erros " << r.branch_mispredictions
+                      << ", acerto " << (r.branches ? 100.0 * (r.branches - r.branch_mispredictions) / r.branches : 100.0)
+                      << "%, flush " << r.branch_flush_cycles << " ciclos)\n";
+            std::cout << "  Stalls       : load-use " << r.stall_load_use
+                      << " / RAW " << r.stall_raw
+                      << " (forwarding EX/MEM " << r.forwards_ex_mem
+                      << ", MEM/WB " << r.forwards_mem_wb << ")\n";
+            std::cout << "  TLB hit/miss : " << r.tlb_hits << " / " << r.tlb_misses << "\n";
+            std::cout << "  Page faults  : " << r.page_faults
+                      << " (" << r.page_fault_cycles << " ciclos de swap)\n";
             std::cout << "  IO cycles    : " << r.io_cycles << "\n";
+            std::cout << "  Trocas ctx   : " << r.context_switches
+                      << " (salvar/restaurar " << r.context_switch_cycles
+                      << ", drenagem " << r.switch_drain_cycles
+                      << ", warm-up " << r.warmup_cycles << " ciclos)\n";
+            std::cout << "  Traps        : " << r.traps
+                      << " (" << r.interrupt_cycles << " ciclos de tratador)\n";
+            if (r.profiled) {
+                std::cout << "  Mix          :";
+                for (size_t c = 0; c < INSTR_CLASS_COUNT; c++)
+                    std::cout << " " << instrClassName(static_cast<InstrClass>(c)) << " " << r.instr_mix[c];
+                std::cout << "\n";
+                if (!r.hot_blocks.empty()) {
+                    const auto &b = r.hot_blocks.front();
+                    std::cout << "  Bloco quente : PC " << b.start << "-" << b.end << ", "
+                              << b.executions << " execuções, " << b.cycles() << " ciclos\n";
+                }
+            }
             std::cout << "--------------------------------------------------------\n";
         }
     }
@@ -135,27 +378,233 @@ public:
         std::cout << "\n================ MÉTRICAS (CORES) ==================\n";
 
         for (auto& c : R) {
-            std::cout << "CORE " << c.coreId << "\n";
+            std::cout << "CORE " << c.coreId;
+            if (c.profile != CoreProfile().name) std::cout << " (" << c.profile << ")";
+            std::cout << "\n";
             std::cout << "  Tempo executando      : " << c.running_time << "\n";
             std::cout << "  Tempo esperando I/O   : " << c.waiting_io_time << "\n";
             std::cout << "  Tempo ocioso          : " << c.idle_time << "\n";
+            std::cout << "  Instruções / IPC      : " << c.instructions << " / " << c.ipc
+                      << " (largura " << c.issue_width << ")\n";
+            if (c.clock != 1.0 || c.power != 1.0) {
+                std::cout << "  Clock / potência      : " << c.clock << "x / " << c.power
+                          << " (energia " << c.energy << ", "
+                          << (c.energy > 0 ? c.instructions / c.energy : 0.0)
+                          << " instruções por unidade)\n";
+            }
+            if (c.energy_model) {
+                const auto &e = c.energy_stats;
+                std::cout << "  Energia               : " << e.totalNj() << " nJ (dinâmica "
+                          << e.dynamicNj << ", memória " << e.memoryNj << ", leakage "
+                          << e.leakageNj << " [ocioso " << e.idleLeakageNj << "], transições "
+                          << e.transitionNj << ")\n";
+                std::cout << "  DVFS (" << c.governor << ")     : " << e.transitions << " trocas;";
+                for (size_t l = 0; l < c.dvfs_levels.size(); l++)
+                    std::cout << " " << c.dvfs_levels[l].freq << "x/" << c.dvfs_levels[l].voltage
+                              << "V " << e.ticksAtLevel[l] << " ticks";
+                std::cout << "\n";
+            }
+            if (c.issue_width > 1) {
+                std::cout << "  Grupos cortados       : dependência " << c.cut_dependency
+                          << ", ALU " << c.cut_alu << ", memória " << c.cut_mem << "\n";
+            }
+            if (c.contexts.size() > 1) {
+                std::cout << "  Slots de despacho     : " << c.issue_utilization * 100.0 << "% usados\n";
+                for (size_t i = 0; i < c.contexts.size(); i++) {
+                    const auto &x = c.contexts[i];
+                    double util = x.active ? 100.0 * x.issued / x.active : 0.0;
+                    std::cout << "  Contexto " << i << "            : ativo " << x.active
+                              << ", despachou " << x.issued << " (" << util << "%), parado "
+                              << x.waiting << "\n";
+                }
+            }
+            if (c.out_of_order) {
+                std::cout << "  ROB médio / cheio     : " << c.rob_avg << " / " << c.rob_full
+                          << " ciclos (RS " << c.rs_full << ", LSQ " << c.lsq_full << ")\n";
+                std::cout << "  Latência de loads     : " << c.load_latency << " ciclos, "
+                          << c.head_mem_stall << " expostos no commit\n";
+                std::cout << "  Descartadas / fwd LSQ : " << c.squashed << " / " << c.store_forwards << "\n";
+            }
+            if (c.context_switches > 0) {
+                std::cout << "  Trocas de contexto    : " << c.context_switches
+                          << " (salvar/restaurar " << c.switch_cycles << ", drenagem "
+                          << c.drain_cycles << ", warm-up " << c.warmup_cycles << " ciclos)\n";
+            }
+            if (c.interrupts) {
+                uint64_t ticks = c.running_time + c.waiting_io_time + c.idle_time;
+                std::cout << "  Interrupções          : timer " << c.irq.timer << ", I/O " << c.irq.io
+                          << ", falta de página " << c.irq.pageFaults << ", syscall " << c.irq.syscalls
+                          << " (" << (ticks ? 1000.0 * c.irq.total() / ticks : 0.0) << " por 1000 ticks, "
+                          << c.irq.handlerCycles << " ciclos de tratador = "
+                          << (ticks ? 100.0 * c.irq.handlerCycles / ticks : 0.0) << "%)\n";
+            }
+            if (c.bus_requests > 0) {
+                std::cout << "  Acessos ao barramento : " << c.bus_requests
+                          << " (fila " << c.bus_wait_cycles << " ciclos, row hit/miss "
+                          << c.row_hits << " / " << c.row_misses << ")\n";
+            }
             std::cout << "-----------------------------------------------------\n";
         }
     }
 
+    // ============================================================
+    //                 PRINT MÉTRICAS CACHE
+    // ============================================================
+    static void printCacheMetrics(const CacheReport& c) {
+        std::cout << "\n================ MÉTRICAS (CACHE) ==================\n";
+        std::cout << "  L1 hits / misses      : " << c.l1_hits << " / " << c.l1_misses << "\n";
+        std::cout << "  Misses compulsórios   : " << c.miss_compulsory << "\n";
+        std::cout << "  Misses de capacidade  : " << c.miss_capacity << "\n";
+        std::cout << "  Misses de conflito    : " << c.miss_conflict << "\n";
+        std::cout << "  Victim hits / misses  : " << c.victim_hits << " / " << c.victim_misses << "\n";
+        std::cout << "-----------------------------------------------------\n";
+    }
+
     // ============================================================
     //                   SALVAR CSV
     // ============================================================
+    static void saveCacheCSV(const CacheReport& c,
+                             const std::vector<PCBReport>& R,
+                             const std::string& file)
+    {
+        std::ofstream f(file);
+        f << "pid,cache_hits,cache_misses,miss_compulsory,miss_capacity,"
+          << "miss_conflict,victim_hits\n";
+
+        for (auto& r : R) {
+            f << r.pid << ","
+              << r.cache_hits << ","
+              << r.cache_misses << ","
+              << r.miss_compulsory << ","
+              << r.miss_capacity << ","
+              << r.miss_conflict << ","
+              << r.victim_hits << "\n";
+        }
+
+        // Linha agregada (victim misses só existem no nível global)
+        f << "total,"
+          << c.l1_hits << ","
+          << c.l1_misses << ","
+          << c.miss_compulsory << ","
+          << c.miss_capacity << ","
+          << c.miss_conflict << ","
+          << c.victim_hits << "\n";
+    }
+
+    // ============================================================
+    //        PERFIL: HOTSPOTS E PILHAS PARA FLAMEGRAPH
+    // ============================================================
+    // Ciclos estimados por PC = execuções + bolhas no EX + memória
+    // (busca e MEM). Os blocos básicos vêm dos desvios observados.
+    static void saveHotspotReport(const std::vector<PCBReport>& R, const std::string& file,
+                                  size_t top = 10)
+    {
+        std::ofstream f(file);
+
+        for (auto& r : R) {
+            if (!r.profiled) continue;
+
+            uint64_t total = 0;
+            for (const auto &b : r.hot_blocks) total += b.cycles();
+            auto pct = [total](uint64_t c) { return total ? 100.0 * c / total : 0.0; };
+
+            f << "PID " << r.pid << " (" << r.name << "): " << total << " ciclos;";
+            for (size_t c = 0; c < INSTR_CLASS_COUNT; c++)
+                f << " " << instrClassName(static_cast<InstrClass>(c)) << " " << r.instr_mix[c];
+            f << "\n";
+
+            f << "  Blocos básicos:\n";
+            for (size_t i = 0; i < r.hot_blocks.size() && i < top; i++) {
+                const auto &b = r.hot_blocks[i];
+                f << "    PC " << b.start << "-" << b.end << ": " << b.cycles() << " ciclos ("
+                  << std::fixed << std::setprecision(1) << pct(b.cycles()) << "%), "
+                  << b.executions << " execuções, " << b.instructions << " instruções, bolhas "
+                  << b.stallCycles << ", memória " << b.memCycles << "\n";
+            }
+
+            f << "  PCs:\n";
+            for (size_t i = 0; i < r.hot_pcs.size() && i < top; i++) {
+                const auto &c = r.hot_pcs[i];
+                f << "    PC " << c.pc << " [" << instrClassName(c.cls) << "]: " << c.cycles()
+                  << " ciclos (" << std::fixed << std::setprecision(1) << pct(c.cycles()) << "%), "
+                  << c.executions << " execuções, bolhas " << c.stallCycles
+                  << ", memória " << c.memCycles << "\n";
+            }
+            f << "\n";
+        }
+    }
+
+    // Formato "folded" (flamegraph.pl, speedscope): processo;bloco;PC ciclos
+    static void saveFoldedStacks(const std::vector<PCBReport>& R, const std::string& file)
+    {
+        std::ofstream f(file);
+
+        for (auto& r : R) {
+            if (!r.profiled) continue;
+
+            std::string proc = r.name.empty() ? "proc" : r.name;
+            for (char &ch : proc)
+                if (ch == ' ' || ch == ';') ch = '_';
+            proc += "_pid" + std::to_string(r.pid);
+
+            for (const auto &c : r.hot_pcs) {
+                uint32_t start = c.pc, end = c.pc;
+                for (const auto &b : r.hot_blocks) {
+                    if (c.pc >= b.start && c.pc <= b.end) { start = b.start; end = b.end; break; }
+                }
+                f << proc << ";bb_" << start << "_" << end << ";pc_" << c.pc << "_"
+                  << instrClassName(c.cls) << " " << c.cycles() << "\n";
+            }
+        }
+    }
+
     static void saveCoreCSV(const std::vector<CoreReport>& R, const std::string& file)
     {
         std::ofstream f(file);
-        f << "core_id,running,waiting_io,idle\n";
+        f << "core_id,running,waiting_io,idle,bus_requests,bus_wait_cycles,row_hits,row_misses,"
+          << "issue_width,instructions,ipc,cut_dependency,cut_alu,cut_mem,"
+          << "rob_avg,rob_full,load_latency,head_mem_stall,squashed,"
+          << "smt_contexts,issue_utilization,profile,clock,power,energy,"
+          << "energy_nj,dvfs_transitions,"
+          << "context_switches,switch_cycles,drain_cycles,warmup_cycles,"
+          << "irq_timer,irq_io,traps,interrupt_cycles\n";
 
         for (auto& c : R) {
             f << c.coreId << ","
               << c.running_time << ","
               << c.waiting_io_time << ","
-              << c.idle_time << "\n";
+              << c.idle_time << ","
+              << c.bus_requests << ","
+              << c.bus_wait_cycles << ","
+              << c.row_hits << ","
+              << c.row_misses << ","
+              << c.issue_width << ","
+              << c.instructions << ","
+              << c.ipc << ","
+              << c.cut_dependency << ","
+              << c.cut_alu << ","
+              << c.cut_mem << ","
+              << c.rob_avg << ","
+              << c.rob_full << ","
+              << c.load_latency << ","
+              << c.head_mem_stall << ","
+              << c.squashed << ","
+              << c.contexts.size() << ","
+              << c.issue_utilization << ","
+              << c.profile << ","
+              << c.clock << ","
+              << c.power << ","
+              << c.energy << ","
+              << c.energy_stats.totalNj() << ","
+              << c.energy_stats.transitions << ","
+              << c.context_switches << ","
+              << c.switch_cycles << ","
+              << c.drain_cycles << ","
+              << c.warmup_cycles << ","
+              << c.irq.timer << ","
+              << c.irq.io << ","
+              << c.irq.pageFaults + c.irq.syscalls << ","
+              << c.irq.handlerCycles << "\n";
         }
     }
 };
@@ -35,6 +35,10 @@ public:
         uint64_t total_service_time;
         uint64_t total_waiting_time;
         uint64_t total_turnaround_time;
+
+        // Energia (modelo de energia/DVFS; 0 quando desligado)
+        double energy_joules = 0.0;
+        double edp = 0.0;             // energia × tempo total (J·s)
     };
     
     // Estrutura para comparação Single-Core vs Multicore
@@ -60,10 +64,14 @@ public:
         const std::vector<Metrics::PCBReport>& reports,
         SchedPolicy policy,
         uint64_t total_cycles,
-        size_t num_cores
+        size_t num_cores,
+        double energy_joules = 0.0,
+        double tick_seconds = 1e-9
     ) {
         PolicyMetrics pm;
         pm.policy = policy;
+        pm.energy_joules = energy_joules;
+        pm.edp = energy_joules * total_cycles * tick_seconds;
         
         // Nome da política
         switch (policy) {
@@ -202,7 +210,7 @@ public:
     ) {
         std::ofstream fout(filename);
         fout << "policy,avg_waiting_time,avg_turnaround_time,cpu_utilization,"
-             << "throughput,efficiency,num_processes,total_cycles\n";
+             << "throughput,efficiency,num_processes,total_cycles,energy_joules,edp\n";
         
         for (const auto& m : metrics) {
             fout << m.policy_name << ","
@@ -212,7 +220,9 @@ public:
                  << m.throughput << ","
                  << m.efficiency << ","
                  << m.num_processes << ","
-                 << m.total_cycles << "\n";
+                 << m.total_cycles << ","
+                 << std::scientific << std::setprecision(4) << m.energy_joules << ","
+                 << m.edp << std::defaultfloat << "\n";
         }
     }
     
@@ -223,7 +233,7 @@ public:
     ) {
         std::ofstream fout(filename);
         fout << "policy,avg_waiting_time,avg_turnaround_time,cpu_utilization,"
-             << "throughput,efficiency,num_processes,total_cycles\n";
+             << "throughput,efficiency,num_processes,total_cycles,energy_joules,edp\n";
         
         for (const auto& m : allMetrics) {
             fout << m.policy_name << ","
@@ -233,7 +243,9 @@ public:
                  << m.throughput << ","
                  << m.efficiency << ","
                  << m.num_processes << ","
-                 << m.total_cycles << "\n";
+                 << m.total_cycles << ","
+                 << std::scientific << std::setprecision(4) << m.energy_joules << ","
+                 << m.edp << std::defaultfloat << "\n";
         }
     }
     
@@ -273,6 +285,11 @@ public:
                       << m.efficiency << "\n";
             std::cout << "  Número de processos        : " << m.num_processes << "\n";
             std::cout << "  Total de ciclos            : " << m.total_cycles << "\n";
+            if (m.energy_joules > 0) {
+                std::cout << "  Energia                    : " << std::scientific
+                          << std::setprecision(4) << m.energy_joules << " J (EDP "
+                          << m.edp << " J·s)" << std::fixed << std::setprecision(2) << "\n";
+            }
         }
         std::cout << "==========================================================\n";
     }
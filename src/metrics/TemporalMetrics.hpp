@@ -17,6 +17,8 @@ struct TemporalSnapshot {
     uint64_t tick;
     double cpu_usage_percent;      // % de CPU em uso
     double memory_usage_percent;    // % de memória em uso
+    double external_fragmentation;  // % do livre fora do maior buraco
+    double internal_fragmentation;  // % do alocado não pedido pelos processos
     double throughput_instant;      // Throughput instantâneo (processos completados / tick)
     size_t active_processes;       // Processos ativos neste momento
     size_t completed_processes;    // Processos completados até agora
@@ -50,14 +52,13 @@ public:
         snap.cpu_usage_percent = num_cores > 0 ? 
             ((double)active_cores / num_cores) * 100.0 : 0.0;
         
-        // Memory Usage: partições ocupadas
-        const auto& partitions = memory.getPartitions();
-        size_t occupied = 0;
-        for (const auto& p : partitions) {
-            if (!p.free) occupied++;
-        }
-        snap.memory_usage_percent = partitions.empty() ? 0.0 :
-            ((double)occupied / partitions.size()) * 100.0;
+        // Memory Usage: partições (ou quadros de página) ocupados
+        snap.memory_usage_percent = memory.usagePercent();
+
+        // Fragmentação (partições fixas, variáveis ou buddy)
+        FragmentationStats frag = memory.fragmentation();
+        snap.external_fragmentation = frag.external * 100.0;
+        snap.internal_fragmentation = frag.internal * 100.0;
         
         // Throughput instantâneo: processos completados desde último tick
         if (tick > last_tick) {
@@ -82,7 +83,8 @@ public:
     void saveCSV(const std::string& filename) const {
         std::ofstream fout(filename);
         fout << "tick,cpu_usage_percent,memory_usage_percent,"
-             << "throughput_instant,active_processes,completed_processes\n";
+             << "throughput_instant,active_processes,completed_processes,"
+             << "external_fragmentation,internal_fragmentation\n";
         
         for (const auto& s : snapshots) {
             fout << s.tick << ","
@@ -90,7 +92,9 @@ public:
                  << s.memory_usage_percent << ","
                  << s.throughput_instant << ","
                  << s.active_processes << ","
-                 << s.completed_processes << "\n";
+                 << s.completed_processes << ","
+                 << s.external_fragmentation << ","
+                 << s.internal_fragmentation << "\n";
         }
     }
     
@@ -1,6 +1,21 @@
 #include "Core.hpp"
+#include <algorithm>
+#include <bitset>
 #include <iostream>
 
+namespace {
+// Registradores salvos/restaurados numa troca: 32 GPRs + pc, hi, lo,
+// sr, epc e cr (mar e ir não precisam sobreviver à troca)
+constexpr uint64_t SPECIAL_REGISTERS = 6;
+constexpr uint64_t CONTEXT_REGISTERS = 32 + SPECIAL_REGISTERS;
+
+// eret: volta para epc e desliga EXL
+void returnFromTrap(hw::REGISTER_BANK &regs) {
+    regs.pc.write(regs.epc.read());
+    regs.sr.write(regs.sr.read() & ~SR_EXL);
+}
+}
+
 // ==========================================================
 //  CONSTRUTOR
 // ==========================================================
@@ -8,21 +23,17 @@ Core::Core(int id, MemoryManager* memManager_, IOManager* ioManager_, bool* prin
     : coreId(id),
       memManager(memManager_),
       ioManager(ioManager_),
-      current(nullptr),
       printLockPtr(printLock),
       printLockFlag(false),
       state(IDLE),
-      counter(0),
-      counterForEnd(5),
-      endProgram(false),
-      endExecution(false),
-      clockCounter(0),
       time_running(0),
       time_idle(0),
       time_waiting_io(0)
 {
     if (printLockPtr)
         printLockFlag = *printLockPtr;
+
+    contexts.resize(1);
 }
 
 Core::~Core() = default;
@@ -33,6 +44,8 @@ Core::~Core() = default;
 // ==========================================================
 void Core::updateCoreTime()
 {
+    energy.tick(state == RUNNING);
+
     switch (state)
     {
         case RUNNING:
@@ -55,56 +68,193 @@ void Core::updateCoreTime()
 bool Core::assignProcess(PCB* pcb) {
 
     if (!pcb) return false;
-    if (current != nullptr) return false;
 
-    current = pcb;
-    current->state = State::Running;
+    HardwareContext* free = nullptr;
+    for (auto &hw : contexts) {
+        if (!hw.current) { free = &hw; break; }
+    }
+    if (!free) return false;
+
+    HardwareContext &hw = *free;
+    hw.current = pcb;
+    hw.current->state = State::Running;
+    hw.current->last_core = coreId;
 
     // Reset pipeline counters
-    counter = 0;
-    counterForEnd = 5;
-    endProgram = false;
-    endExecution = false;
-    clockCounter = 0;
+    hw.counter = 0;
+    hw.counterForEnd = 5;
+    hw.endProgram = false;
+    hw.endExecution = false;
+    hw.clockCounter = 0;
+
+    // Timer do contexto recarregado com o quantum do processo
+    hw.timerLeft = pcb->quantum > 0 ? static_cast<uint64_t>(pcb->quantum) : 1;
+    hw.timerFired = false;
+    hw.handlerStall = 0;
+
+    // Troca de contexto: restauração dos registradores de quem entra
+    // (lazy: nada a restaurar se o contexto ainda guarda este processo)
+    bool same = hw.lastPid == pcb->pid;
+    hw.saving = false;
+    hw.dirtyRegs = 0;
+    hw.switchStall = 0;
+    hw.warmupLeft = 0;
+    if (switchConfig.enabled) {
+        if (!(switchConfig.lazyRegisters && same))
+            hw.switchStall = CONTEXT_REGISTERS * switchConfig.cyclesPerRegister;
+        if (!same) hw.warmupLeft = switchConfig.warmupAccesses;
+    }
 
-    ioRequests.clear();
-    uc.data.clear();   // <<< EVITA lixo no pipeline
+    hw.ioRequests.clear();
+    hw.data.clear();   // <<< EVITA lixo no pipeline
+    if (hw.ooo) hw.ooo->reset();
 
     // Construção do ControlContext compatível com CONTROL_UNIT.hpp
-    contextPtr = std::make_unique<ControlContext>(
-        current->regBank,
+    hw.contextPtr = std::make_unique<ControlContext>(
+        hw.current->regBank,
         *memManager,
-        ioRequests,
+        hw.ioRequests,
         printLockFlag,
-        *current,
-        counter,
-        counterForEnd,
-        endProgram,
-        endExecution
+        *hw.current,
+        hw.counter,
+        hw.counterForEnd,
+        hw.endProgram,
+        hw.endExecution
     );
 
     state = RUNNING;
     return true;
 }
 
+bool Core::isIdle() const {
+    for (const auto &hw : contexts)
+        if (hw.current) return false;
+    return true;
+}
+
+bool Core::hasFreeContext() const {
+    for (const auto &hw : contexts)
+        if (!hw.current) return true;
+    return false;
+}
+
+PCB* Core::getCurrentPCB() const {
+    for (const auto &hw : contexts)
+        if (hw.current) return hw.current;
+    return nullptr;
+}
+
 
 // ==========================================================
-//   stepOneCycle — executa 1 ciclo do pipeline
+//  configureSMT
 // ==========================================================
-CoreEvent Core::stepOneCycle() {
+void Core::configureSMT(size_t n, SmtFetchPolicy policy) {
+    if (!isIdle()) return;
+    if (n < 1) n = 1;
+
+    fetchPolicy = policy;
+    rrNext = 0;
+    contexts.clear();
+    contexts.resize(n);
+    configureOutOfOrder(oooConfig);
+}
 
-    CoreEvent ev;
-    ev.type = CoreEvent::NONE;
-    ev.pcb = nullptr;
-    ev.coreId = coreId;
 
-    // Core sem processo
-    if (!current || !contextPtr) {
-        state = IDLE;
-        return ev;
+// ==========================================================
+//  applyProfile / takeClockCycles — cores heterogêneos
+// ==========================================================
+void Core::applyProfile(const CoreProfile &p) {
+    if (!isIdle()) return;
+
+    profile = p;
+    if (profile.clock <= 0.0) profile.clock = 1.0;
+    clockCredit = 0.0;
+
+    configureIssue(p.issue);
+    oooConfig = p.ooo;
+    configureSMT(p.smtContexts, p.smtPolicy);   // recria os ROBs
+    if (memManager) memManager->setCoreCacheCycles(coreId, p.cacheCycles);
+    configureEnergy(energyConfig);
+}
+
+void Core::configureEnergy(const EnergyConfig &cfg) {
+    energyConfig = cfg;
+    energy = EnergyMeter(cfg, profile.power);
+}
+
+int Core::takeClockCycles() {
+    clockCredit += profile.clock * energy.frequency();
+    int n = static_cast<int>(clockCredit);
+    clockCredit -= n;
+    return n;
+}
+
+std::vector<Core::ContextStats> Core::getContextStats() const {
+    std::vector<ContextStats> r;
+    for (const auto &hw : contexts) r.push_back(hw.stats);
+    return r;
+}
+
+
+// ==========================================================
+//  configureIssue
+// ==========================================================
+void Core::configureIssue(const IssueConfig &cfg) {
+    issue = cfg;
+    if (issue.width < 1) issue.width = 1;
+    if (issue.alus < 1) issue.alus = 1;
+    if (issue.memPorts < 1) issue.memPorts = 1;
+}
+
+void Core::configureOutOfOrder(const OutOfOrderConfig &cfg) {
+    oooConfig = cfg;
+    for (auto &hw : contexts) {
+        if (cfg.enabled) hw.ooo = std::make_unique<OutOfOrderEngine>(cfg);
+        else hw.ooo.reset();
+    }
+}
+
+OutOfOrderEngine::Stats Core::getOutOfOrderStats() const {
+    OutOfOrderEngine::Stats t;
+    for (const auto &hw : contexts) {
+        if (!hw.ooo) continue;
+        const auto &s = hw.ooo->getStats();
+        t.committed          += s.committed;
+        t.squashed           += s.squashed;
+        t.robFullCycles      += s.robFullCycles;
+        t.rsFullCycles       += s.rsFullCycles;
+        t.lsqFullCycles      += s.lsqFullCycles;
+        t.storeForwards      += s.storeForwards;
+        t.loadLatency        += s.loadLatency;
+        t.headMemStallCycles += s.headMemStallCycles;
+        t.robOccupancy       += s.robOccupancy;
+        t.cycles             += s.cycles;
+        for (size_t c = 0; c < INSTR_CLASS_COUNT; c++)
+            t.committedByClass[c] += s.committedByClass[c];
     }
+    return t;
+}
+
+static bool usesMemPort(const std::string &op) {
+    return op == "LW" || op == "SW";
+}
+
+static bool usesAlu(const std::string &op) {
+    return !op.empty() && !usesMemPort(op) && op != "J" && op != "JAL" && op != "END";
+}
 
-    ControlContext& ctx = *contextPtr;
+
+// ==========================================================
+//  runStages — um passo do pipeline (uma instrução por estágio)
+// ==========================================================
+bool Core::runStages(HardwareContext& hw, IssueGroup& group) {
+
+    ControlContext& ctx = *hw.contextPtr;
+
+    // Perfil: ciclos de memória de cada estágio vão para o PC da instrução
+    InstructionProfile& prof = hw.current->profile;
+    const bool profiling = prof.enabled();
+    auto memCycles = [&]() { return profiling ? hw.current->memory_cycles.load() : 0; };
 
     // -------------------------------------------------------
     // GARANTIR TAMANHO DO PIPELINE
@@ -112,26 +262,49 @@ CoreEvent Core::stepOneCycle() {
     if (uc.data.size() <= static_cast<size_t>(ctx.counter))
         uc.data.resize(ctx.counter + 1);
 
-
-    // =======================================================
-    //                    PIPELINE
-    // =======================================================
-
     // WB
     if (ctx.counter >= 4 && ctx.counterForEnd >= 1)
         uc.Write_Back(uc.data[ctx.counter - 4], ctx);
 
     // MEM
-    if (ctx.counter >= 3 && ctx.counterForEnd >= 2)
+    if (ctx.counter >= 3 && ctx.counterForEnd >= 2) {
+        uint64_t before = memCycles();
         uc.Memory_Acess(uc.data[ctx.counter - 3], ctx);
+        if (profiling) prof.addMemory(uc.data[ctx.counter - 3].pc, memCycles() - before);
+    }
+
+    // EXEC (a unidade de hazards pode segurar a instrução um ciclo)
+    bool stall = false;
+    if (ctx.counter >= 2 && ctx.counterForEnd >= 3) {
+        stall = uc.Hazard_Stall(ctx);
+        if (!stall) {
+            Instruction_Data &ex = uc.data[ctx.counter - 2];
+            if (!ex.op.empty() && ex.op != "END") {
+                instructions_executed++;
+                energy.onInstruction(classifyOp(ex.op));
+                if (profiling) prof.record(ex.pc, classifyOp(ex.op));
+                group.regs.push_back(ex.regs);
+                if (ex.regs.dest > 0) hw.dirtyRegs |= 1u << ex.regs.dest;
+                if (usesMemPort(ex.op)) group.memPorts++;
+                if (usesAlu(ex.op)) group.alus++;
+                if (ex.branchKind != BranchKind::NONE) group.branch = true;
+            }
+            uc.Execute(ex, ctx);
+        }
+    }
+
+    if (stall) {
+        if (profiling) prof.addStall(uc.data[ctx.counter - 2].pc);
 
-    // EXEC
-    if (ctx.counter >= 2 && ctx.counterForEnd >= 3)
-        uc.Execute(uc.data[ctx.counter - 2], ctx);
+        // Bolha no lugar do EX: EX/ID/IF ficam parados e as instruções
+        // mais novas andam uma posição no buffer, sem nova busca
+        uc.data.insert(uc.data.begin() + (ctx.counter - 2), Instruction_Data());
+        return true;
+    }
 
     // DECODE
     if (ctx.counter >= 1 && ctx.counterForEnd >= 4) {
-        current->stage_invocations.fetch_add(1);
+        hw.current->stage_invocations.fetch_add(1);
         uc.Decode(ctx.registers, uc.data[ctx.counter - 1]);
     }
 
@@ -139,23 +312,302 @@ CoreEvent Core::stepOneCycle() {
     if (ctx.counter >= 0 && ctx.counterForEnd == 5) {
         Instruction_Data newData;
         uc.data[ctx.counter] = newData;
+        uint64_t before = memCycles();
         uc.Fetch(ctx);
+        if (profiling) prof.addMemory(ctx.registers.mar.read(), memCycles() - before);
     }
+    return false;
+}
+
 
-    // Avança o tempo
-    ctx.counter++;
-    clockCounter++;
-    current->pipeline_cycles.fetch_add(1);
+// ==========================================================
+//  canIssueMore — regras do grupo de despacho
+// ==========================================================
+// Enchimento, drenagem e bloqueios seguem um passo por ciclo, como no
+// core escalar; só o regime permanente despacha mais de uma instrução.
+bool Core::canIssueMore(ControlContext& ctx, const IssueGroup& group) {
+    if (ctx.endExecution || ctx.counterForEnd != 5 || ctx.counter < 4)
+        return false;
+    if (ctx.process.state == State::Blocked || group.branch)
+        return false;
+
+    const Instruction_Data &next = uc.data[ctx.counter - 2];
+    if (next.op.empty()) return true;
+
+    for (const RegUsage &older : group.regs) {
+        if (HazardUnit::dependsOn(next.regs, older)) {
+            issue_cut_dependency++;
+            return false;
+        }
+    }
 
+    if (usesMemPort(next.op) && group.memPorts >= issue.memPorts) {
+        issue_cut_mem++;
+        return false;
+    }
+    if (usesAlu(next.op) && group.alus >= issue.alus) {
+        issue_cut_alu++;
+        return false;
+    }
+
+    // Load do ciclo anterior ainda no MEM (load-use): fica para o próximo ciclo
+    const RegUsage* mem = &uc.data[ctx.counter - 3].regs;
+    const RegUsage* wb  = &uc.data[ctx.counter - 4].regs;
+    if (uc.hazards.check(next.regs, mem, wb).stall) {
+        issue_cut_dependency++;
+        return false;
+    }
+    return true;
+}
+
+
+// ==========================================================
+//  wantsIssue / inFlight — usados pela política SMT
+// ==========================================================
+bool Core::wantsIssue(const HardwareContext& hw) const {
+    int c = hw.counter;
+    if (c < 2 || hw.counterForEnd < 3 || hw.data.size() <= static_cast<size_t>(c - 2))
+        return false;
+
+    const Instruction_Data &ex = hw.data[c - 2];
+    if (ex.op.empty() || ex.op == "END") return false;
+
+    // Vai virar bolha: o slot fica para outro contexto
+    const RegUsage* mem = c >= 3 ? &hw.data[c - 3].regs : nullptr;
+    const RegUsage* wb  = c >= 4 ? &hw.data[c - 4].regs : nullptr;
+    return !uc.hazards.check(ex.regs, mem, wb).stall;
+}
+
+size_t Core::inFlight(const HardwareContext& hw) const {
+    if (hw.ooo) return hw.ooo->occupancy();
+
+    size_t n = 0;
+    for (int k = 1; k <= 2; k++) {
+        int i = hw.counter - k;
+        if (i >= 0 && static_cast<size_t>(i) < hw.data.size() && !hw.data[i].op.empty())
+            n++;
+    }
+    return n;
+}
+
+
+// ==========================================================
+//   stepCycle — 1 ciclo do core (todos os contextos)
+// ==========================================================
+// Os contextos disputam os `issue.width` slots de despacho na ordem da
+// política. Passos sem instrução nova no EX (enchimento, drenagem,
+// bolha) não gastam slot; um contexto sem slot fica parado no ciclo.
+// No backend fora de ordem só um contexto busca por ciclo e os demais
+// seguem executando e fazendo commit.
+std::vector<CoreEvent> Core::stepCycle() {
+
+    std::vector<CoreEvent> events;
+
+    // Interrupções pendentes; o tratador do fim de I/O ocupa o core
+    if (interrupts && serviceInterrupts(events)) {
+        state = RUNNING;
+        return events;
+    }
+
+    // Core sem processo
+    if (isIdle()) {
+        state = IDLE;
+        return events;
+    }
+
+    std::vector<size_t> order;
+    for (size_t i = 0; i < contexts.size(); i++) {
+        size_t k = (rrNext + i) % contexts.size();
+        if (contexts[k].current) order.push_back(k);
+    }
+    if (fetchPolicy == SmtFetchPolicy::ICOUNT) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return inFlight(contexts[a]) < inFlight(contexts[b]);
+        });
+    }
+    rrNext = (rrNext + 1) % contexts.size();
+
+    int slots = issue.width;
+    bool blocked = false;
+    cycles_running++;
+
+    // Energia dos acessos à memória: acessos do passo × MemWeights
+    auto weighted = [](const PCB &p) {
+        return p.cache_mem_accesses.load() * p.memWeights.cache
+             + p.primary_mem_accesses.load() * p.memWeights.primary
+             + p.secondary_mem_accesses.load() * p.memWeights.secondary;
+    };
+
+    for (size_t k : order) {
+        HardwareContext &hw = contexts[k];
+        PCB* pcb = hw.current;
+        uint64_t before = energy.enabled() ? weighted(*pcb) : 0;
+        uint64_t accesses = pcb->mem_accesses_total.load();
+
+        CoreEvent ev = stepContext(hw, slots);
+        if (energy.enabled()) energy.onMemory(weighted(*pcb) - before);
+
+        // Warm-up: primeiros acessos depois da troca pagam a cache fria
+        if (hw.warmupLeft > 0) {
+            uint64_t n = std::min(pcb->mem_accesses_total.load() - accesses, hw.warmupLeft);
+            uint64_t penalty = n * switchConfig.warmupCycles;
+            hw.warmupLeft -= n;
+            pcb->memory_cycles.fetch_add(penalty);
+            pcb->warmup_cycles.fetch_add(penalty);
+            warmup_cycles += penalty;
+        }
+
+        if (ev.type == CoreEvent::NONE) continue;
+        if (ev.type == CoreEvent::BLOCKED) blocked = true;
+        events.push_back(std::move(ev));
+    }
+
+    if (!isIdle()) state = RUNNING;
+    else state = blocked ? WAITING_IO : IDLE;
+
+    return events;
+}
+
+CoreEvent Core::stepOneCycle() {
+    std::vector<CoreEvent> events = stepCycle();
+    if (events.empty()) {
+        CoreEvent ev;
+        ev.coreId = coreId;
+        return ev;
+    }
+    return std::move(events.front());
+}
+
+
+// ==========================================================
+//   stepContext — executa 1 ciclo do pipeline de um contexto
+// ==========================================================
+CoreEvent Core::stepContext(HardwareContext& hw, int& slots) {
+
+    CoreEvent ev;
+    ev.type = CoreEvent::NONE;
+    ev.pcb = nullptr;
+    ev.coreId = coreId;
+
+    hw.stats.active++;
+
+    // Troca de contexto em andamento: registradores sendo restaurados
+    // (entrada) ou salvos (saída, com o evento guardado até o fim)
+    if (hw.switchStall > 0) {
+        hw.switchStall--;
+        switch_cycles++;
+        hw.current->context_switch_cycles.fetch_add(1);
+        if (hw.switchStall > 0 || !hw.saving) return ev;
+
+        ev = std::move(hw.pendingEvent);
+        hw.saving = false;
+        release(hw);
+        return ev;
+    }
+
+    // Tratador do trap de saída: no fim, eret e o processo segue para o
+    // salvamento dos registradores
+    if (hw.handlerStall > 0) {
+        hw.handlerStall--;
+        interrupt_cycles++;
+        interrupts->countHandlerCycle(coreId);
+        hw.current->interrupt_cycles.fetch_add(1);
+        if (hw.handlerStall > 0) return ev;
+
+        returnFromTrap(hw.current->regBank);
+        return switchOut(hw, std::move(hw.pendingEvent));
+    }
+
+    bool fetch = slots > 0;
+    if (!hw.ooo && !fetch && wantsIssue(hw)) {
+        hw.stats.waiting++;
+        return ev;
+    }
+
+    ControlContext& ctx = *hw.contextPtr;
+    PCB* current = hw.current;
+
+    // Quantum esgotado (ou falta de página): os ciclos de drenagem até a
+    // saída fazem parte do custo da troca
+    if (ctx.endExecution && !ctx.endProgram) {
+        drain_cycles++;
+        current->switch_drain_cycles.fetch_add(1);
+    }
+
+    // O buffer do pipeline da Control_Unit passa a ser o deste contexto
+    std::swap(uc.data, hw.data);
 
     // =======================================================
-    //     QUANTUM OU END
+    //                    PIPELINE
     // =======================================================
-    if (clockCounter >= current->quantum || ctx.endProgram)
-        ctx.endExecution = true;
+    // Um passo por instrução despachada: com width > 1 o core dá
+    // vários passos no mesmo ciclo enquanto o grupo for válido.
+    IssueGroup group;
+    bool stall = false;
+    uint64_t issued = 0;
+
+    if (hw.ooo) {
+        if (fetch) slots = 0;
+        else hw.stats.waiting++;
+
+        auto byClass = hw.ooo->getStats().committedByClass;
+        issued = hw.ooo->cycle(ctx, uc, issue.width, issue.alus, issue.memPorts, fetch);
+        for (size_t c = 0; c < INSTR_CLASS_COUNT; c++)
+            energy.onInstruction(static_cast<InstrClass>(c),
+                                 hw.ooo->getStats().committedByClass[c] - byClass[c]);
+        instructions_executed += issued;
+        hw.clockCounter++;
+        current->pipeline_cycles.fetch_add(1);
+        tickTimer(hw);
+
+        if (quantumExpired(hw) || ctx.endProgram)
+            ctx.endExecution = true;
+        if (current->page_fault_wait.load() > 0)
+            ctx.endExecution = true;
+
+        // Drenagem: termina quando tudo que foi buscado fez commit
+        ctx.counterForEnd = (ctx.endExecution && hw.ooo->empty()) ? 0 : 5;
+    }
+
+    int lanes = slots > 0 ? slots : 1;
+    for (int lane = 0; !hw.ooo; ++lane) {
+        stall = runStages(hw, group);
+
+        // Avança o tempo
+        ctx.counter++;
+        if (lane == 0) {
+            hw.clockCounter++;
+            current->pipeline_cycles.fetch_add(1);
+            tickTimer(hw);
+        }
+
+        // ===================================================
+        //     QUANTUM OU END
+        // ===================================================
+        if (quantumExpired(hw) || ctx.endProgram)
+            ctx.endExecution = true;
+
+        // Falta de página atendida neste ciclo: para de buscar, drena o
+        // pipeline e bloqueia até a página chegar do swap
+        if (current->page_fault_wait.load() > 0)
+            ctx.endExecution = true;
+
+        // Bolha atrasa a drenagem em um ciclo
+        if (ctx.endExecution && !stall)
+            ctx.counterForEnd--;
+
+        if (lane + 1 >= std::min(issue.width, lanes) || stall || !canIssueMore(ctx, group))
+            break;
+    }
 
-    if (ctx.endExecution)
-        ctx.counterForEnd--;
+    if (!hw.ooo) {
+        issued = group.regs.size();
+        slots -= static_cast<int>(issued);
+        if (slots < 0) slots = 0;
+    }
+    if (issued > 0) hw.stats.issued++;
+
+    std::swap(uc.data, hw.data);
 
 
     // =======================================================
@@ -170,24 +622,27 @@ CoreEvent Core::stepOneCycle() {
             ev.type = CoreEvent::FINISHED;
             ev.pcb = current;
 
-            contextPtr.reset();
-            state = IDLE;
-            current = nullptr;
-
+            release(hw);
             return ev;
         }
 
+        // -------------- BLOQUEIO POR FALTA DE PÁGINA --------------
+        if (current->page_fault_wait.load() > 0) {
+            current->state = State::Blocked;
+
+            ev.type = CoreEvent::BLOCKED;
+            ev.pcb = current;
+
+            return enterTrap(hw, std::move(ev), TrapCause::PAGE_FAULT);
+        }
+
         // -------------- PREEMPÇÃO POR QUANTUM --------------
         current->state = State::Ready;
 
         ev.type = CoreEvent::PREEMPTED;
         ev.pcb = current;
 
-        contextPtr.reset();
-        state = IDLE;
-        current = nullptr;
-
-        return ev;
+        return enterTrap(hw, std::move(ev), TrapCause::INTERRUPT, CR_IP_TIMER);
     }
 
 
@@ -198,15 +653,12 @@ CoreEvent Core::stepOneCycle() {
 
         ev.type = CoreEvent::BLOCKED;
         ev.pcb = current;
+        current->io_blocks.fetch_add(1);
 
         // Passa a requisição de IO para o evento
-        ev.ioRequests = std::move(ioRequests);
-
-        contextPtr.reset();
-        state = WAITING_IO;
-        current = nullptr;
+        ev.ioRequests = std::move(hw.ioRequests);
 
-        return ev;
+        return enterTrap(hw, std::move(ev), TrapCause::SYSCALL);
     }
 
 
@@ -216,3 +668,123 @@ CoreEvent Core::stepOneCycle() {
     return ev;
 }
 
+
+// ==========================================================
+//   switchOut / release — saída do processo do contexto
+// ==========================================================
+// Preempção e bloqueio salvam os registradores antes de liberar o
+// contexto; o evento só chega ao escalonador quando o salvamento termina.
+// Lazy salva só os GPRs escritos (o backend fora de ordem não rastreia
+// isso e salva todos). O processo que termina não precisa ser salvo.
+CoreEvent Core::switchOut(HardwareContext& hw, CoreEvent ev) {
+    PCB* p = hw.current;
+    p->context_switches.fetch_add(1);
+    context_switches++;
+
+    uint64_t cost = 0;
+    if (switchConfig.enabled) {
+        uint64_t regs = CONTEXT_REGISTERS;
+        if (switchConfig.lazyRegisters && !hw.ooo)
+            regs = std::bitset<32>(hw.dirtyRegs).count() + SPECIAL_REGISTERS;
+        cost = regs * switchConfig.cyclesPerRegister;
+
+        if (switchConfig.flushCache) cost += memManager->invalidateCache(*p);
+        if (switchConfig.flushTLB) memManager->flushTLB(coreId);
+    }
+
+    if (cost == 0) {
+        release(hw);
+        return ev;
+    }
+
+    hw.saving = true;
+    hw.switchStall = cost;
+    hw.pendingEvent = std::move(ev);
+
+    CoreEvent none;
+    none.coreId = coreId;
+    return none;
+}
+
+void Core::release(HardwareContext& hw) {
+    hw.lastPid = hw.current->pid;
+    hw.contextPtr.reset();
+    hw.current = nullptr;
+}
+
+
+// ==========================================================
+//   Interrupções — timer, fim de I/O e traps de saída
+// ==========================================================
+// Com o controlador, o quantum vira um timer por contexto: ao zerar, a
+// interrupção entra na fila do core e é atendida no início do ciclo
+// seguinte (o processo para de buscar e drena, como antes). A entrada
+// no tratador acontece com o pipeline vazio, então epc é preciso.
+void Core::tickTimer(HardwareContext& hw) {
+    if (!interrupts || hw.timerLeft == 0) return;
+    if (--hw.timerLeft == 0)
+        interrupts->raiseTimer(coreId, static_cast<int>(&hw - contexts.data()), hw.current);
+}
+
+bool Core::quantumExpired(const HardwareContext& hw) const {
+    if (interrupts) return hw.timerFired;
+    return hw.clockCounter >= hw.current->quantum;
+}
+
+bool Core::serviceInterrupts(std::vector<CoreEvent>& events) {
+    Interrupt irq;
+    while (!irqPcb && interrupts->take(coreId, irq)) {
+        if (irq.source == InterruptSource::TIMER) {
+            // O processo pode ter saído (bloqueio) antes do atendimento
+            if (irq.context >= 0 && static_cast<size_t>(irq.context) < contexts.size() &&
+                contexts[irq.context].current == irq.pcb)
+                contexts[irq.context].timerFired = true;
+            continue;
+        }
+        if (!irq.pcb) continue;
+
+        irqPcb = irq.pcb;
+        irqLeft = interrupts->handlerCycles(TrapCause::INTERRUPT, InterruptSource::IO);
+        interrupts->countTrap(coreId, TrapCause::INTERRUPT, InterruptSource::IO);
+        irqPcb->traps.fetch_add(1);
+    }
+    if (!irqPcb) return false;
+
+    // O tratador rouba os ciclos do core; no fim o processo volta aos prontos
+    bool busy = irqLeft > 0;
+    if (busy) {
+        irqLeft--;
+        interrupt_cycles++;
+        interrupts->countHandlerCycle(coreId);
+        irqPcb->interrupt_cycles.fetch_add(1);
+        if (irqLeft > 0) return true;
+    }
+
+    events.emplace_back(CoreEvent::IO_COMPLETE, irqPcb, coreId);
+    irqPcb = nullptr;
+    return busy;
+}
+
+CoreEvent Core::enterTrap(HardwareContext& hw, CoreEvent ev, TrapCause cause, uint32_t pending) {
+    if (!interrupts) return switchOut(hw, std::move(ev));
+
+    hw::REGISTER_BANK &regs = hw.current->regBank;
+    regs.epc.write(regs.pc.read());
+    regs.sr.write(regs.sr.read() | SR_EXL);
+    regs.cr.write(causeBits(cause, pending));
+
+    interrupts->countTrap(coreId, cause);
+    hw.current->traps.fetch_add(1);
+
+    hw.handlerStall = interrupts->handlerCycles(cause);
+    if (hw.handlerStall == 0) {
+        returnFromTrap(regs);
+        return switchOut(hw, std::move(ev));
+    }
+
+    hw.pendingEvent = std::move(ev);
+
+    CoreEvent none;
+    none.coreId = coreId;
+    return none;
+}
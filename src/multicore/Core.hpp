@@ -9,6 +9,10 @@
 #include "../IO/IOManager.hpp"
 #include "../memory/MemoryManager.hpp"
 #include "../cpu/CONTROL_UNIT.hpp"
+#include "../cpu/OutOfOrderEngine.hpp"
+#include "EnergyModel.hpp"
+#include "InterruptController.hpp"
+#include "Scheduler.hpp"
 
 // =====================================================================================
 //                       CoreEvent — EVENTO DO PIPELINE
@@ -20,7 +24,8 @@ struct CoreEvent {
         NONE = 0,
         FINISHED = 1,
         BLOCKED = 2,
-        PREEMPTED = 3
+        PREEMPTED = 3,
+        IO_COMPLETE = 4     // tratador do fim de I/O: pcb volta aos prontos
     };
 
     Type type;
@@ -43,6 +48,81 @@ struct CoreEvent {
 };
 
 
+// =====================================================================================
+//                 IssueConfig — LARGURA DE DESPACHO DO CORE
+// =====================================================================================
+// width = quantas instruções entram no EX por ciclo (1 = pipeline escalar).
+// O grupo é montado em ordem e para na primeira instrução que depende de
+// outra do grupo, que passaria do limite de ALUs ou de portas de memória,
+// ou que vem depois de um desvio.
+struct IssueConfig {
+    int width = 1;
+    int alus = 1;       // ADD/ADDI/desvios/PRINT... por ciclo
+    int memPorts = 1;   // LW/SW por ciclo
+};
+
+
+// =====================================================================================
+//                 SMT — POLÍTICA DE BUSCA ENTRE CONTEXTOS
+// =====================================================================================
+// Com mais de um contexto de hardware, a cada ciclo a política define a
+// ordem em que os contextos disputam os slots de despacho do core:
+// - ROUND_ROBIN: prioridade rotativa;
+// - ICOUNT: primeiro quem tem menos instruções em voo no front-end.
+enum class SmtFetchPolicy { ROUND_ROBIN, ICOUNT };
+
+
+// =====================================================================================
+//                 CoreProfile — CORES HETEROGÊNEOS (big.LITTLE)
+// =====================================================================================
+// Descrição de um tipo de core (core_loader lê de JSON). clock é relativo
+// ao tick global: 2.0 = dois ciclos de pipeline por tick, 0.5 = um ciclo a
+// cada dois ticks. power é o peso de potência do core quando executando.
+// cacheCycles substitui o custo de hit da cache (memWeights.cache) para
+// acessos feitos por este core (0 = usa o peso do processo).
+struct CoreProfile {
+    std::string name = "core";
+    CoreClass coreClass = CoreClass::BIG;
+    size_t count = 1;
+
+    double clock = 1.0;
+    double power = 1.0;
+    uint64_t cacheCycles = 0;
+
+    IssueConfig issue;
+    OutOfOrderConfig ooo;
+    size_t smtContexts = 1;
+    SmtFetchPolicy smtPolicy = SmtFetchPolicy::ICOUNT;
+};
+
+
+// =====================================================================================
+//                 ContextSwitchConfig — CUSTO DA TROCA DE CONTEXTO
+// =====================================================================================
+// Com enabled, cada processo que sai do core (preempção ou bloqueio)
+// segura o contexto enquanto os registradores são salvos, e cada processo
+// que entra espera a restauração. São 32 GPRs + 6 especiais (pc, hi, lo,
+// sr, epc, cr), cyclesPerRegister ciclos cada.
+// - lazyRegisters: salva só os GPRs escritos desde a entrada e não
+//   restaura nada se o mesmo processo volta ao contexto que deixou;
+// - flushCache: a cache (compartilhada) é invalidada na saída, com a
+//   escrita das linhas sujas somada ao salvamento;
+// - flushTLB: esvazia a TLB do core na saída (sem ASID);
+// - warmupAccesses/warmupCycles: os primeiros acessos depois de entrar
+//   pagam ciclos extras de memória (cache fria de outro processo).
+// A drenagem do pipeline na preempção já é simulada; os ciclos dela são
+// contados como custo da troca em qualquer caso.
+struct ContextSwitchConfig {
+    bool enabled = false;
+    uint64_t cyclesPerRegister = 1;
+    bool lazyRegisters = false;
+    bool flushCache = false;
+    bool flushTLB = false;
+    uint64_t warmupAccesses = 0;
+    uint64_t warmupCycles = 0;
+};
+
+
 // =====================================================================================
 //                                      CORE
 // =====================================================================================
@@ -52,6 +132,13 @@ class Core {
 public:
     enum LocalState { IDLE = 0, RUNNING = 1, WAITING_IO = 2 };
 
+    // Uso de um contexto de hardware (SMT)
+    struct ContextStats {
+        uint64_t active = 0;    // ciclos com processo
+        uint64_t issued = 0;    // ciclos em que despachou instrução
+        uint64_t waiting = 0;   // ciclos parado por perder os slots
+    };
+
     Core(int id,
          MemoryManager* memManager_,
          IOManager* ioManager_,
@@ -59,13 +146,71 @@ public:
 
     ~Core();
 
+    // Coloca o processo num contexto livre (false se todos ocupados)
     bool assignProcess(PCB* pcb);
+
+    // Um ciclo de todos os contexts; um evento por processo que saiu
+    std::vector<CoreEvent> stepCycle();
+
+    // Versão de um contexto: devolve o primeiro evento (ou NONE)
     CoreEvent stepOneCycle();
 
-    bool isIdle() const { return current == nullptr; }
+    bool isIdle() const;                 // nenhum contexto com processo
+    bool hasFreeContext() const;
     int getId() const { return coreId; }
     LocalState getState() const { return state; }
-    PCB* getCurrentPCB() const { return current; }
+    PCB* getCurrentPCB() const;          // primeiro contexto ocupado
+
+    // SMT: número de contextos de hardware (só com o core vazio)
+    void configureSMT(size_t contexts, SmtFetchPolicy policy = SmtFetchPolicy::ROUND_ROBIN);
+    size_t getContextCount() const { return contexts.size(); }
+    SmtFetchPolicy getFetchPolicy() const { return fetchPolicy; }
+    std::vector<ContextStats> getContextStats() const;
+
+    // Preditor de desvios do core (estado compartilhado entre processos)
+    void configureBranchPredictor(const BranchPredictorConfig &cfg) { uc.predictor = BranchPredictor(cfg); }
+    const BranchPredictor& getBranchPredictor() const { return uc.predictor; }
+
+    // Encaminhamento EX/MEM e MEM/WB (false = todo RAW vira bolha)
+    void setForwarding(bool on) { uc.hazards.setForwarding(on); }
+
+    // Superescalar: N instruções por ciclo com limites estruturais
+    void configureIssue(const IssueConfig &cfg);
+    const IssueConfig& getIssueConfig() const { return issue; }
+
+    // Backend fora de ordem (ROB/RS/LSQ); desligado = pipeline em ordem.
+    // Usa width/alus/memPorts do IssueConfig para busca, unidades e commit.
+    // Com SMT cada contexto tem o seu ROB (recursos particionados).
+    void configureOutOfOrder(const OutOfOrderConfig &cfg);
+    const OutOfOrderEngine* getOutOfOrder() const { return contexts[0].ooo.get(); }
+    bool isOutOfOrder() const { return oooConfig.enabled; }
+    OutOfOrderEngine::Stats getOutOfOrderStats() const;   // soma dos contextos
+
+    // Tipo do core (issue, OoO, SMT, clock, potência); só com o core vazio
+    void applyProfile(const CoreProfile &p);
+    const CoreProfile& getProfile() const { return profile; }
+    CoreClass getCoreClass() const { return profile.coreClass; }
+
+    // Ciclos de pipeline que cabem neste tick (acumula a fração do clock
+    // × frequência do nível DVFS; nenhum durante uma transição)
+    int takeClockCycles();
+
+    // Energia (nJ) e DVFS do core; a potência do perfil escala o medidor
+    void configureEnergy(const EnergyConfig &cfg);
+    const EnergyMeter& getEnergyMeter() const { return energy; }
+
+    // Custo de troca de contexto (salvar/restaurar, flush, warm-up)
+    void configureContextSwitch(const ContextSwitchConfig &cfg) { switchConfig = cfg; }
+    const ContextSwitchConfig& getContextSwitchConfig() const { return switchConfig; }
+
+    // Interrupções: timer por contexto (no lugar da contagem do quantum),
+    // fim de I/O e traps com os vetores do controlador (nullptr = sem)
+    void setInterruptController(InterruptController* ic) { interrupts = ic; }
+    bool handlingInterrupt() const { return irqPcb != nullptr; }
+
+    // Nó NUMA ao qual o core pertence (-1 = sem NUMA)
+    int getNumaNode() const { return numaNode; }
+    void setNumaNode(int node) { numaNode = node; }
 
     // ============================
     //    NOVO → MÉTRICAS DO CORE
@@ -83,8 +228,117 @@ public:
     uint64_t time_idle      = 0;
     uint64_t time_waiting_io = 0;
 
+    // Instruções que passaram pelo EX (IPC = executadas / time_running)
+    // e grupos de despacho cortados antes da largura máxima, por motivo
+    uint64_t instructions_executed = 0;
+    uint64_t issue_cut_dependency  = 0;
+    uint64_t issue_cut_alu         = 0;
+    uint64_t issue_cut_mem         = 0;
+
+    // Ciclos do próprio core com processo (clock e DVFS inclusos)
+    uint64_t cycles_running = 0;
+    double getRunningCycles() const { return static_cast<double>(cycles_running); }
+
+    // Trocas de contexto: saídas (preempção/bloqueio) e os ciclos perdidos
+    uint64_t context_switches = 0;
+    uint64_t switch_cycles    = 0;   // salvar/restaurar + flush da cache
+    uint64_t drain_cycles     = 0;   // pipeline drenando após o quantum
+    uint64_t warmup_cycles    = 0;   // acessos extras com a cache fria
+
+    // Ciclos dentro de tratadores de interrupção/trap
+    uint64_t interrupt_cycles = 0;
+
+    double getIPC() const {
+        double cycles = getRunningCycles();
+        return cycles > 0 ? instructions_executed / cycles : 0.0;
+    }
+
+    // Fração dos slots de despacho usados (width × ciclos executando)
+    double getIssueUtilization() const {
+        double slots = getRunningCycles() * issue.width;
+        return slots > 0 ? instructions_executed / slots : 0.0;
+    }
+
+    // Energia relativa: peso de potência × ticks executando
+    double getEnergy() const { return profile.power * time_running; }
+
 private:
 
+    // Estado de um processo no core: contadores do pipeline, buffer de
+    // instruções e contexto de controle (o banco de registradores e o
+    // PC ficam no PCB). O preditor, a unidade de hazards, as ALUs e a
+    // cache são do core, compartilhados entre os contextos.
+    struct HardwareContext {
+        PCB* current = nullptr;
+        std::unique_ptr<ControlContext> contextPtr;
+
+        std::vector<Instruction_Data> data;   // trocado com uc.data no passo
+        std::unique_ptr<OutOfOrderEngine> ooo;
+
+        int counter = 0;
+        int counterForEnd = 5;
+        bool endProgram = false;
+        bool endExecution = false;
+
+        std::vector<std::unique_ptr<IORequest>> ioRequests;
+
+        int clockCounter = 0;
+
+        // Troca de contexto: ciclos restantes de salvamento/restauração,
+        // evento de saída guardado enquanto salva e estado para o lazy
+        uint64_t switchStall = 0;
+        bool saving = false;
+        CoreEvent pendingEvent;
+        uint32_t dirtyRegs = 0;      // GPRs escritos desde a entrada
+        int lastPid = -1;            // último processo neste contexto
+        uint64_t warmupLeft = 0;
+
+        // Interrupções: timer (ciclos até disparar), quantum esgotado
+        // e ciclos restantes do tratador do trap de saída
+        uint64_t timerLeft = 0;
+        bool timerFired = false;
+        uint64_t handlerStall = 0;
+
+        ContextStats stats;
+    };
+
+    // Grupo de instruções que entraram no EX no ciclo corrente
+    struct IssueGroup {
+        std::vector<RegUsage> regs;
+        int alus = 0;
+        int memPorts = 0;
+        bool branch = false;
+    };
+
+    // Um ciclo de um contexto; `slots` = despachos ainda livres no core
+    CoreEvent stepContext(HardwareContext& hw, int& slots);
+
+    // Processo saindo (preempção/bloqueio): cobra o salvamento ou libera
+    CoreEvent switchOut(HardwareContext& hw, CoreEvent ev);
+    void release(HardwareContext& hw);
+
+    // Trap na saída: grava epc/sr/cr e segura o evento durante o tratador
+    CoreEvent enterTrap(HardwareContext& hw, CoreEvent ev, TrapCause cause, uint32_t pending = 0);
+
+    // Atende a fila do core; true = o ciclo foi do tratador de I/O
+    bool serviceInterrupts(std::vector<CoreEvent>& events);
+
+    // Quantum: timer do contexto (com interrupções) ou contagem de ciclos
+    void tickTimer(HardwareContext& hw);
+    bool quantumExpired(const HardwareContext& hw) const;
+
+    // Um passo do pipeline (WB, MEM, EX, ID, IF); true = bolha de hazard
+    bool runStages(HardwareContext& hw, IssueGroup& group);
+
+    // A próxima instrução pode entrar no EX ainda neste ciclo?
+    bool canIssueMore(ControlContext& ctx, const IssueGroup& group);
+
+    // O próximo passo do contexto coloca uma instrução no EX?
+    bool wantsIssue(const HardwareContext& hw) const;
+
+    // Instruções buscadas e ainda não executadas (ICOUNT)
+    size_t inFlight(const HardwareContext& hw) const;
+
     int coreId;
 
     MemoryManager* memManager;
@@ -92,24 +346,29 @@ private:
 
     Control_Unit uc;
 
-    std::unique_ptr<ControlContext> contextPtr;
-
-    PCB* current;
-
     bool* printLockPtr;
     bool printLockFlag;
 
     LocalState state;
 
-    int counter;
-    int counterForEnd;
-    bool endProgram;
-    bool endExecution;
+    int numaNode = -1;
 
-    std::vector<std::unique_ptr<IORequest>> ioRequests;
+    IssueConfig issue;
+    OutOfOrderConfig oooConfig;
 
-    int clockCounter;
+    CoreProfile profile;
+    double clockCredit = 0.0;
 
+    EnergyConfig energyConfig;
+    EnergyMeter energy;
 
-};
+    ContextSwitchConfig switchConfig;
+
+    InterruptController* interrupts = nullptr;
+    PCB* irqPcb = nullptr;        // fim de I/O sendo tratado
+    uint64_t irqLeft = 0;
 
+    std::vector<HardwareContext> contexts;
+    SmtFetchPolicy fetchPolicy = SmtFetchPolicy::ROUND_ROBIN;
+    size_t rrNext = 0;
+};
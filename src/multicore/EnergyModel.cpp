@@ -0,0 +1,85 @@
+#include "EnergyModel.hpp"
+
+// --------------------------------------------------
+// Construtor: começa no nível que o governor escolheria
+// --------------------------------------------------
+EnergyMeter::EnergyMeter(const EnergyConfig &cfg, double powerWeight)
+    : config(cfg), power(powerWeight)
+{
+    if (config.levels.empty()) config.levels.push_back(DvfsLevel());
+    if (config.window == 0) config.window = 1;
+
+    level = config.governor == DvfsGovernor::POWERSAVE ? 0 : config.levels.size() - 1;
+    stats.ticksAtLevel.assign(config.levels.size(), 0);
+}
+
+double EnergyMeter::voltage() const {
+    return config.levels.empty() ? 1.0 : config.levels[level].voltage;
+}
+
+double EnergyMeter::frequency() const {
+    if (!config.enabled) return 1.0;
+    return transitionLeft > 0 ? 0.0 : config.levels[level].freq;
+}
+
+// --------------------------------------------------
+// Dinâmica: C·V² por instrução (C = instrNj da classe)
+// --------------------------------------------------
+void EnergyMeter::onInstruction(InstrClass cls, uint64_t n) {
+    if (!config.enabled || n == 0) return;
+    double v = voltage();
+    stats.dynamicNj += config.instrNj[static_cast<size_t>(cls)] * v * v * power * n;
+    stats.instructions[static_cast<size_t>(cls)] += n;
+}
+
+void EnergyMeter::onMemory(uint64_t weightedAccesses) {
+    if (!config.enabled) return;
+    stats.memoryNj += config.memNjPerWeight * weightedAccesses;
+}
+
+// --------------------------------------------------
+// TICK — leakage (∝ V) e decisão do governor por janela
+// --------------------------------------------------
+void EnergyMeter::tick(bool busy) {
+    if (!config.enabled) return;
+
+    double leak = config.leakageNjPerTick * voltage() * power;
+    stats.leakageNj += leak;
+    if (!busy) stats.idleLeakageNj += leak;
+    stats.ticksAtLevel[level]++;
+
+    if (transitionLeft > 0) {
+        transitionLeft--;
+        return;
+    }
+
+    windowTicks++;
+    if (busy) windowBusy++;
+    if (windowTicks >= config.window) {
+        governor();
+        windowTicks = 0;
+        windowBusy = 0;
+    }
+}
+
+void EnergyMeter::governor() {
+    size_t top = config.levels.size() - 1;
+    double util = static_cast<double>(windowBusy) / windowTicks;
+
+    switch (config.governor) {
+        case DvfsGovernor::PERFORMANCE: setLevel(top); break;
+        case DvfsGovernor::POWERSAVE:   setLevel(0);   break;
+        case DvfsGovernor::ONDEMAND:
+            if (util > config.upThreshold) setLevel(top);
+            else if (util < config.downThreshold && level > 0) setLevel(level - 1);
+            break;
+    }
+}
+
+void EnergyMeter::setLevel(size_t l) {
+    if (l >= config.levels.size() || l == level) return;
+    level = l;
+    stats.transitions++;
+    stats.transitionNj += config.transitionNj * power;
+    transitionLeft = config.transitionTicks;
+}
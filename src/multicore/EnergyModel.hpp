@@ -0,0 +1,117 @@
+#ifndef ENERGY_MODEL_HPP
+#define ENERGY_MODEL_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "../cpu/InstructionClass.hpp"
+
+// -------------------------------------------------------------
+//                    DVFS — GOVERNORS
+// -------------------------------------------------------------
+// - PERFORMANCE: sempre no nível mais alto;
+// - POWERSAVE:   sempre no nível mais baixo;
+// - ONDEMAND:    a cada janela, utilização acima de upThreshold sobe
+//                direto para o mais alto, abaixo de downThreshold desce
+//                um nível.
+enum class DvfsGovernor { PERFORMANCE, POWERSAVE, ONDEMAND };
+
+inline const char* governorName(DvfsGovernor g) {
+    switch (g) {
+        case DvfsGovernor::PERFORMANCE: return "performance";
+        case DvfsGovernor::POWERSAVE:   return "powersave";
+        case DvfsGovernor::ONDEMAND:    return "ondemand";
+    }
+    return "?";
+}
+
+// Ponto de operação: freq multiplica o clock do core, voltage escala a
+// energia dinâmica (V²) e o leakage (V)
+struct DvfsLevel {
+    double freq = 1.0;
+    double voltage = 1.0;
+};
+
+struct EnergyConfig {
+    bool enabled = false;
+
+    // Energia dinâmica por instrução a 1 V (nJ), por InstrClass
+    std::array<double, INSTR_CLASS_COUNT> instrNj = {1.0, 3.0, 1.2, 1.5, 1.5, 2.0};
+
+    // Acesso à memória: nJ por unidade de MemWeights (cache 1, RAM 5,
+    // disco 10 no padrão), fora do domínio de tensão do core
+    double memNjPerWeight = 0.5;
+
+    // Estática a 1 V por tick, ativo ou ocioso
+    double leakageNjPerTick = 0.2;
+
+    std::vector<DvfsLevel> levels = {{0.5, 0.8}, {0.75, 0.9}, {1.0, 1.0}};
+    uint64_t transitionTicks = 2;      // core parado durante a troca
+    double transitionNj = 10.0;
+
+    DvfsGovernor governor = DvfsGovernor::PERFORMANCE;
+    uint64_t window = 10;              // ticks por decisão do governor
+    double upThreshold = 0.8;
+    double downThreshold = 0.3;
+
+    double tickSeconds = 1e-9;         // duração de um tick (EDP em J·s)
+};
+
+// -------------------------------------------------------------
+//                ENERGY METER (um por core)
+// -------------------------------------------------------------
+// Acumula a energia do core em nJ; powerWeight (CoreProfile::power)
+// escala a parte dinâmica e o leakage do core.
+class EnergyMeter {
+public:
+    struct Stats {
+        double dynamicNj = 0.0;
+        double memoryNj = 0.0;
+        double leakageNj = 0.0;
+        double idleLeakageNj = 0.0;     // parte do leakage em ticks ociosos
+        double transitionNj = 0.0;
+        uint64_t transitions = 0;
+        std::array<uint64_t, INSTR_CLASS_COUNT> instructions{};
+        std::vector<uint64_t> ticksAtLevel;
+
+        double totalNj() const { return dynamicNj + memoryNj + leakageNj + transitionNj; }
+    };
+
+    EnergyMeter() = default;
+    EnergyMeter(const EnergyConfig &cfg, double powerWeight);
+
+    bool enabled() const { return config.enabled; }
+
+    void onInstruction(InstrClass cls, uint64_t n = 1);
+    void onMemory(uint64_t weightedAccesses);
+
+    // Um tick global: leakage, amostra de utilização e governor
+    void tick(bool busy);
+
+    // Troca de nível pedida de fora (ou pelo governor)
+    void setLevel(size_t level);
+
+    // Frequência relativa atual; 0 durante uma transição
+    double frequency() const;
+    size_t getLevel() const { return level; }
+    double voltage() const;
+
+    const Stats& getStats() const { return stats; }
+    const EnergyConfig& getConfig() const { return config; }
+
+private:
+    EnergyConfig config;
+    double power = 1.0;
+    size_t level = 0;
+
+    uint64_t transitionLeft = 0;
+    uint64_t windowTicks = 0;
+    uint64_t windowBusy = 0;
+
+    Stats stats;
+
+    void governor();
+};
+
+#endif
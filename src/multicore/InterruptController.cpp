@@ -0,0 +1,83 @@
+#include "InterruptController.hpp"
+
+// --------------------------------------------------
+// Construtor
+// --------------------------------------------------
+InterruptController::InterruptController(size_t cores, const InterruptConfig &cfg)
+    : config(cfg), queues(cores), stats(cores)
+{
+}
+
+// --------------------------------------------------
+// Levantar interrupções
+// --------------------------------------------------
+void InterruptController::raiseTimer(int core, int context, PCB* pcb) {
+    std::lock_guard<std::mutex> lk(lock);
+    queues[core].push_back({InterruptSource::TIMER, context, pcb});
+}
+
+int InterruptController::raiseIO(PCB* pcb) {
+    std::lock_guard<std::mutex> lk(lock);
+
+    int n = static_cast<int>(queues.size());
+    int core = 0;
+    switch (config.ioRouting) {
+        case IoRouting::FIXED:
+            core = config.ioTargetCore;
+            break;
+        case IoRouting::ROUND_ROBIN:
+            core = static_cast<int>(rrNext++ % queues.size());
+            break;
+        case IoRouting::LAST_CORE:
+            core = pcb ? pcb->last_core : 0;
+            break;
+    }
+    if (core < 0 || core >= n) core = 0;
+
+    queues[core].push_back({InterruptSource::IO, -1, pcb});
+    return core;
+}
+
+bool InterruptController::take(int core, Interrupt &out) {
+    std::lock_guard<std::mutex> lk(lock);
+    auto &q = queues[core];
+    if (q.empty()) return false;
+
+    out = q.front();
+    q.pop_front();
+    return true;
+}
+
+size_t InterruptController::pending() const {
+    std::lock_guard<std::mutex> lk(lock);
+    size_t n = 0;
+    for (const auto &q : queues) n += q.size();
+    return n;
+}
+
+// --------------------------------------------------
+// Vetores: latência do tratador de cada causa
+// --------------------------------------------------
+uint64_t InterruptController::handlerCycles(TrapCause cause, InterruptSource source) const {
+    switch (cause) {
+        case TrapCause::INTERRUPT:
+            return source == InterruptSource::IO ? config.ioLatency : config.timerLatency;
+        case TrapCause::PAGE_FAULT:
+            return config.pageFaultLatency;
+        case TrapCause::SYSCALL:
+            return config.syscallLatency;
+    }
+    return 0;
+}
+
+void InterruptController::countTrap(int core, TrapCause cause, InterruptSource source) {
+    CoreStats &s = stats[core];
+    switch (cause) {
+        case TrapCause::INTERRUPT:
+            if (source == InterruptSource::IO) s.io++;
+            else s.timer++;
+            break;
+        case TrapCause::PAGE_FAULT: s.pageFaults++; break;
+        case TrapCause::SYSCALL:    s.syscalls++;   break;
+    }
+}
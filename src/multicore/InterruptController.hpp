@@ -0,0 +1,109 @@
+#ifndef INTERRUPT_CONTROLLER_HPP
+#define INTERRUPT_CONTROLLER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "../cpu/PCB.hpp"
+
+// -------------------------------------------------------------
+//                 TRAPS — CÓDIGOS E VETORES
+// -------------------------------------------------------------
+// Como no MIPS, a entrada no tratador grava:
+// - epc: PC onde o processo continua depois do eret;
+// - sr:  bit EXL ligado enquanto o tratador roda;
+// - cr:  ExcCode (bits 2..6) e, para interrupções, o pino em IP
+//        (bits 8..15): IP2 = fim de I/O, IP7 = timer.
+// Cada causa tem um vetor com a latência do tratador em ciclos.
+enum class TrapCause : uint32_t {
+    INTERRUPT  = 0,   // externa (timer ou I/O)
+    PAGE_FAULT = 2,   // TLBL: falta de página
+    SYSCALL    = 8,   // PRINT bloqueante
+};
+
+enum class InterruptSource { TIMER, IO };
+
+constexpr uint32_t SR_EXL      = 1u << 1;
+constexpr uint32_t CR_IP_IO    = 1u << 10;
+constexpr uint32_t CR_IP_TIMER = 1u << 15;
+
+inline uint32_t causeBits(TrapCause cause, uint32_t pending = 0) {
+    return (static_cast<uint32_t>(cause) << 2) | pending;
+}
+
+// Para qual core vai a interrupção de fim de I/O
+// - FIXED:       sempre ioTargetCore;
+// - ROUND_ROBIN: alterna entre os cores;
+// - LAST_CORE:   o core onde o processo rodou por último.
+enum class IoRouting { FIXED, ROUND_ROBIN, LAST_CORE };
+
+struct InterruptConfig {
+    bool enabled = false;
+
+    // Latência dos tratadores (ciclos do core) — vetores
+    uint64_t timerLatency = 10;
+    uint64_t ioLatency = 8;
+    uint64_t pageFaultLatency = 20;
+    uint64_t syscallLatency = 6;
+
+    IoRouting ioRouting = IoRouting::ROUND_ROBIN;
+    int ioTargetCore = 0;
+};
+
+struct Interrupt {
+    InterruptSource source = InterruptSource::TIMER;
+    int context = -1;     // TIMER: contexto SMT do processo
+    PCB* pcb = nullptr;
+};
+
+// -------------------------------------------------------------
+//                 INTERRUPT CONTROLLER
+// -------------------------------------------------------------
+// Uma fila de interrupções pendentes por core. O timer de cada
+// contexto e o IOManager (na thread dele) levantam interrupções; o core
+// as atende no início do ciclo seguinte. As exceções (traps) são
+// síncronas e não passam pela fila, só pelos vetores e contadores.
+class InterruptController {
+public:
+    struct CoreStats {
+        uint64_t timer = 0;
+        uint64_t io = 0;
+        uint64_t pageFaults = 0;
+        uint64_t syscalls = 0;
+        uint64_t handlerCycles = 0;   // ciclos dentro de tratadores
+
+        uint64_t total() const { return timer + io + pageFaults + syscalls; }
+    };
+
+    InterruptController(size_t cores, const InterruptConfig &cfg);
+
+    void raiseTimer(int core, int context, PCB* pcb);
+
+    // Fim de I/O: escolhe o core pelo roteamento; devolve o core
+    int raiseIO(PCB* pcb);
+
+    // Próxima interrupção pendente do core (false = nenhuma)
+    bool take(int core, Interrupt &out);
+    size_t pending() const;
+
+    // Latência do vetor da causa (INTERRUPT: depende da origem)
+    uint64_t handlerCycles(TrapCause cause, InterruptSource source = InterruptSource::TIMER) const;
+
+    // Contabilidade feita pelo core ao entrar num tratador
+    void countTrap(int core, TrapCause cause, InterruptSource source = InterruptSource::TIMER);
+    void countHandlerCycle(int core) { stats[core].handlerCycles++; }
+
+    const InterruptConfig& getConfig() const { return config; }
+    const std::vector<CoreStats>& getStats() const { return stats; }
+
+private:
+    InterruptConfig config;
+    std::vector<std::deque<Interrupt>> queues;
+    std::vector<CoreStats> stats;
+    size_t rrNext = 0;
+    mutable std::mutex lock;
+};
+
+#endif
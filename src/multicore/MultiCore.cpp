@@ -11,25 +11,142 @@ MultiCore::MultiCore(size_t n, MemoryManager* memMgr, IOManager* ioMgr, bool* pr
     }
 }
 
+MultiCore::MultiCore(const std::vector<CoreProfile>& profiles, MemoryManager* memMgr,
+                     IOManager* ioMgr, bool* printLock)
+    : memManager(memMgr), ioManager(ioMgr), printLockPtr(printLock)
+{
+    for (const auto &p : profiles) {
+        for (size_t i = 0; i < p.count; ++i) {
+            int id = static_cast<int>(cores.size());
+            cores.emplace_back(std::make_unique<Core>(id, memMgr, ioMgr, printLockPtr));
+            cores.back()->applyProfile(p);
+        }
+    }
+}
+
 MultiCore::~MultiCore() = default;
 
 void MultiCore::assignReadyProcesses(const std::function<PCB*()>& fetchNext) {
     for (auto &cptr : cores) {
         if (!cptr) continue;
 
-        if (cptr->isIdle()) {
+        // Com SMT, um core aceita um processo por contexto livre
+        while (cptr->hasFreeContext()) {
             PCB* p = fetchNext();
-            if (p == nullptr) continue;
+            if (p == nullptr) break;
 
             bool ok = cptr->assignProcess(p);
             if (!ok) {
                 std::cerr << "[MultiCore] Warning: failed to assign PCB pid=" << p->pid
                           << " to core " << cptr->getId() << "\n";
+                break;
+            }
+        }
+    }
+}
+
+void MultiCore::assignReadyProcesses(const std::function<PCB*(int node)>& fetchNext) {
+    for (auto &cptr : cores) {
+        if (!cptr) continue;
+
+        while (cptr->hasFreeContext()) {
+            PCB* p = fetchNext(cptr->getNumaNode());
+            if (p == nullptr) break;
+
+            if (!cptr->assignProcess(p)) {
+                std::cerr << "[MultiCore] Warning: failed to assign PCB pid=" << p->pid
+                          << " to core " << cptr->getId() << "\n";
+                break;
             }
         }
     }
 }
 
+void MultiCore::assignReadyProcesses(const std::function<PCB*(const Core&)>& fetchNext) {
+    for (auto &cptr : cores) {
+        if (!cptr) continue;
+
+        while (cptr->hasFreeContext()) {
+            PCB* p = fetchNext(*cptr);
+            if (p == nullptr) break;
+
+            if (!cptr->assignProcess(p)) {
+                std::cerr << "[MultiCore] Warning: failed to assign PCB pid=" << p->pid
+                          << " to core " << cptr->getId() << "\n";
+                break;
+            }
+        }
+    }
+}
+
+bool MultiCore::isHeterogeneous() const {
+    for (const auto &cptr : cores) {
+        const CoreProfile &a = cptr->getProfile();
+        const CoreProfile &b = cores.front()->getProfile();
+        if (a.name != b.name || a.clock != b.clock || a.power != b.power) return true;
+    }
+    return false;
+}
+
+void MultiCore::assignNumaNodes(size_t nodes) {
+    if (nodes == 0) return;
+    for (size_t i = 0; i < cores.size(); ++i) {
+        int node = static_cast<int>(i * nodes / cores.size());
+        cores[i]->setNumaNode(node);
+        if (memManager) memManager->setCoreNode(cores[i]->getId(), node);
+    }
+}
+
+void MultiCore::configureBranchPredictors(const BranchPredictorConfig &cfg) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureBranchPredictor(cfg);
+}
+
+void MultiCore::setForwarding(bool on) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->setForwarding(on);
+}
+
+void MultiCore::configureIssue(const IssueConfig &cfg) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureIssue(cfg);
+}
+
+void MultiCore::configureOutOfOrder(const OutOfOrderConfig &cfg) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureOutOfOrder(cfg);
+}
+
+void MultiCore::configureSMT(size_t contexts, SmtFetchPolicy policy) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureSMT(contexts, policy);
+}
+
+void MultiCore::configureEnergy(const EnergyConfig &cfg) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureEnergy(cfg);
+}
+
+void MultiCore::configureContextSwitch(const ContextSwitchConfig &cfg) {
+    for (auto &cptr : cores)
+        if (cptr) cptr->configureContextSwitch(cfg);
+}
+
+void MultiCore::configureInterrupts(const InterruptConfig &cfg) {
+    interrupts.reset();
+    if (cfg.enabled) interrupts = std::make_unique<InterruptController>(cores.size(), cfg);
+
+    for (auto &cptr : cores)
+        if (cptr) cptr->setInterruptController(interrupts.get());
+}
+
+double MultiCore::totalEnergyNj() const {
+    double nj = 0.0;
+    for (const auto &cptr : cores)
+        if (cptr) nj += cptr->getEnergyMeter().getStats().totalNj();
+    return nj;
+}
+
 std::vector<CoreEvent> MultiCore::stepAll() {
     std::vector<CoreEvent> events;
     events.reserve(cores.size());
@@ -40,36 +157,49 @@ std::vector<CoreEvent> MultiCore::stepAll() {
         // mede tempo deste core no tick atual
         cptr->updateCoreTime();
 
-        CoreEvent ev = cptr->stepOneCycle();
+        // acessos à memória deste passo pertencem a este core (trace)
+        if (memManager) memManager->setCurrentCore(cptr->getId());
 
-        if (ev.coreId < 0) ev.coreId = cptr->getId();
+        // clock relativo: um core lento pula ticks, um rápido dá mais de um ciclo
+        std::vector<CoreEvent> stepped;
+        for (int n = cptr->takeClockCycles(); n > 0; --n) {
+            for (CoreEvent &ev : cptr->stepCycle())
+                stepped.push_back(std::move(ev));
+            if (cptr->isIdle() && !cptr->handlingInterrupt()) break;
+        }
 
-        if (ev.type == CoreEvent::BLOCKED) {
-            if (ioManager) {
-                try {
-                    ioManager->registerProcessWaitingForIO(ev.pcb, std::move(ev.ioRequests), 100);
-                } catch (const std::exception &ex) {
-                    std::cerr << "[MultiCore] Exception while registering IO: " << ex.what() << "\n";
-                } catch (...) {
-                    std::cerr << "[MultiCore] Unknown exception while registering IO\n";
+        for (CoreEvent &ev : stepped) {
+            if (ev.coreId < 0) ev.coreId = cptr->getId();
+
+            // Bloqueio por falta de página fica com o MemoryManager (swap)
+            if (ev.type == CoreEvent::BLOCKED && ev.pcb->page_fault_wait.load() == 0) {
+                if (ioManager) {
+                    try {
+                        ioManager->registerProcessWaitingForIO(ev.pcb, std::move(ev.ioRequests), 100);
+                    } catch (const std::exception &ex) {
+                        std::cerr << "[MultiCore] Exception while registering IO: " << ex.what() << "\n";
+                    } catch (...) {
+                        std::cerr << "[MultiCore] Unknown exception while registering IO\n";
+                    }
                 }
+
+                ev.ioRequests.clear();
             }
 
-            ev.ioRequests.clear();
             events.push_back(std::move(ev));
-            continue;
         }
-
-        events.push_back(std::move(ev));
     }
 
+    if (memManager) memManager->setCurrentCore(-1);
+
     return events;
 }
 
 bool MultiCore::hasActiveCores() const {
+    if (interrupts && interrupts->pending() > 0) return true;
     for (const auto &cptr : cores) {
         if (!cptr) continue;
-        if (!cptr->isIdle()) return true;
+        if (!cptr->isIdle() || cptr->handlingInterrupt()) return true;
     }
     return false;
 }
@@ -11,13 +11,48 @@
 class MultiCore {
 public:
     MultiCore(size_t n, MemoryManager* memMgr, IOManager* ioMgr, bool* printLock = nullptr);
+
+    // Cores heterogêneos: profile.count cores de cada perfil, na ordem dada
+    MultiCore(const std::vector<CoreProfile>& profiles, MemoryManager* memMgr,
+              IOManager* ioMgr, bool* printLock = nullptr);
     ~MultiCore();
 
     // assignReadyProcesses: fetchNext must return next ready PCB* (or nullptr if none)
     // It will be called repeatedly until all free cores are filled.
     void assignReadyProcesses(const std::function<PCB*()>& fetchNext);
 
-    // stepAll: avança 1 ciclo em todos os cores. Retorna lista de events (finished/blocked/preempted)
+    // Variante com afinidade: fetchNext recebe o nó NUMA do core livre
+    void assignReadyProcesses(const std::function<PCB*(int node)>& fetchNext);
+
+    // Variante com o core inteiro (classe big/LITTLE, nó NUMA, perfil)
+    void assignReadyProcesses(const std::function<PCB*(const Core&)>& fetchNext);
+
+    // Distribui os cores em blocos contíguos pelos nós NUMA e registra
+    // o mapeamento no MemoryManager (first-touch usa o nó do core)
+    void assignNumaNodes(size_t nodes);
+
+    // Mesmo preditor de desvios (tipo/tamanhos) em todos os cores
+    void configureBranchPredictors(const BranchPredictorConfig &cfg);
+    void setForwarding(bool on);
+    void configureIssue(const IssueConfig &cfg);
+    void configureOutOfOrder(const OutOfOrderConfig &cfg);
+    void configureSMT(size_t contexts, SmtFetchPolicy policy);
+    void configureEnergy(const EnergyConfig &cfg);
+    void configureContextSwitch(const ContextSwitchConfig &cfg);
+
+    // Controlador de interrupções compartilhado pelos cores (timer, fim
+    // de I/O e traps); sem enabled, o quantum segue como contagem
+    void configureInterrupts(const InterruptConfig &cfg);
+    InterruptController* getInterruptController() { return interrupts.get(); }
+    const InterruptController* getInterruptController() const { return interrupts.get(); }
+
+    // Energia total dos cores (nJ; 0 com o modelo desligado)
+    double totalEnergyNj() const;
+
+    bool isHeterogeneous() const;
+
+    // stepAll: avança 1 tick em todos os cores (0, 1 ou mais ciclos de
+    // pipeline conforme o clock de cada um). Retorna lista de events (finished/blocked/preempted/fim de I/O)
     std::vector<CoreEvent> stepAll();
 
     bool hasActiveCores() const;
@@ -34,4 +69,5 @@ private:
     MemoryManager* memManager;
     IOManager* ioManager;
     bool* printLockPtr;
+    std::unique_ptr<InterruptController> interrupts;
 };
@@ -13,11 +13,11 @@ void Scheduler::add(PCB* pcb) {
     switch (policy) {
 
     case SchedPolicy::FCFS:
-        readyQueueFCFS.push(pcb);
+        readyQueueFCFS.push_back(pcb);
         break;
 
     case SchedPolicy::RR:
-        readyQueueRR.push(pcb);
+        readyQueueRR.push_back(pcb);
         break;
 
     case SchedPolicy::PRIORITY:
@@ -41,7 +41,7 @@ PCB* Scheduler::fetchNext() {
     case SchedPolicy::FCFS:
         if (!readyQueueFCFS.empty()) {
             PCB* p = readyQueueFCFS.front();
-            readyQueueFCFS.pop();
+            readyQueueFCFS.pop_front();
             return p;
         }
         break;
@@ -49,7 +49,7 @@ PCB* Scheduler::fetchNext() {
     case SchedPolicy::RR:
         if (!readyQueueRR.empty()) {
             PCB* p = readyQueueRR.front();
-            readyQueueRR.pop();
+            readyQueueRR.pop_front();
             return p;
         }
         break;
@@ -67,6 +67,76 @@ PCB* Scheduler::fetchNext() {
     return nullptr;
 }
 
+// --------------------------------------------------
+// Afinidade NUMA: o primeiro pronto (na ordem da política) cuja
+// memória está no nó do core. Sem nenhum, entrega o próximo normal
+// — acesso remoto é mais barato que deixar o core ocioso.
+// --------------------------------------------------
+PCB* Scheduler::fetchNext(int node) {
+    if (node < 0) return fetchNext();
+
+    auto pick = [node](auto &ready) -> PCB* {
+        for (auto it = ready.begin(); it != ready.end(); ++it) {
+            if ((*it)->numa_home == node || (*it)->numa_home < 0) {
+                PCB* p = *it;
+                ready.erase(it);
+                return p;
+            }
+        }
+        return nullptr;
+    };
+
+    PCB* p = nullptr;
+    switch (policy) {
+    case SchedPolicy::FCFS: p = pick(readyQueueFCFS); break;
+    case SchedPolicy::RR:   p = pick(readyQueueRR);   break;
+    case SchedPolicy::PRIORITY:
+    case SchedPolicy::SJN:  p = pick(readyVector);    break;
+    }
+
+    return p ? p : fetchNext();
+}
+
+// --------------------------------------------------
+// big.LITTLE: core big pega o primeiro CPU-bound, LITTLE o primeiro
+// IO-bound (respeitando o nó NUMA se houver um assim). Sem nenhum da
+// classe, cai na escolha normal — core ocioso é o pior caso.
+// --------------------------------------------------
+bool Scheduler::isIOBound(const PCB* p) const {
+    uint64_t blocks = p->io_blocks.load();
+    return blocks > 0 && p->pipeline_cycles.load() / blocks < ioBurstCycles;
+}
+
+PCB* Scheduler::fetchNext(int node, CoreClass cls) {
+    if (!asymmetric) return fetchNext(node);
+
+    bool wantIO = (cls == CoreClass::LITTLE);
+    auto pick = [&](auto &ready, bool sameNode) -> PCB* {
+        for (auto it = ready.begin(); it != ready.end(); ++it) {
+            if (isIOBound(*it) != wantIO) continue;
+            if (sameNode && node >= 0 && (*it)->numa_home >= 0 && (*it)->numa_home != node)
+                continue;
+            PCB* p = *it;
+            ready.erase(it);
+            return p;
+        }
+        return nullptr;
+    };
+
+    PCB* p = nullptr;
+    for (bool sameNode : {true, false}) {
+        switch (policy) {
+        case SchedPolicy::FCFS: p = pick(readyQueueFCFS, sameNode); break;
+        case SchedPolicy::RR:   p = pick(readyQueueRR, sameNode);   break;
+        case SchedPolicy::PRIORITY:
+        case SchedPolicy::SJN:  p = pick(readyVector, sameNode);    break;
+        }
+        if (p) return p;
+    }
+
+    return fetchNext(node);
+}
+
 bool Scheduler::empty() const {
     switch (policy) {
     case SchedPolicy::FCFS: return readyQueueFCFS.empty();
@@ -1,5 +1,5 @@
 #pragma once
-#include <queue>
+#include <deque>
 #include <vector>
 #include <algorithm>
 #include "../cpu/PCB.hpp"
@@ -11,23 +11,38 @@ enum class SchedPolicy {
     SJN
 };
 
+// Classe do core que pede processo (cores heterogêneos)
+enum class CoreClass { BIG, LITTLE };
+
 class Scheduler {
 private:
     SchedPolicy policy;
 
-    std::queue<PCB*> readyQueueFCFS;
-    std::queue<PCB*> readyQueueRR;
+    std::deque<PCB*> readyQueueFCFS;
+    std::deque<PCB*> readyQueueRR;
     std::vector<PCB*> readyVector;
 
+    bool asymmetric = false;
+    uint64_t ioBurstCycles = 40;
+
 public:
     Scheduler(SchedPolicy p);
 
     void add(PCB* pcb);        // processo novo, volta de preempção, etc.
     PCB* fetchNext();          // entrega próximo PCB
+    PCB* fetchNext(int node);  // idem, preferindo processos do nó NUMA
+    PCB* fetchNext(int node, CoreClass cls);  // idem, big → CPU-bound, LITTLE → IO-bound
     void unblock(PCB* pcb);    // ESSENCIAL para IO Worker
     bool empty() const;
 
     void setPolicy(SchedPolicy p) { policy = p; }
     SchedPolicy getPolicy() const { return policy; }
+
+    // big.LITTLE: ligado, fetchNext(node, cls) casa o processo com a
+    // classe do core. IO-bound = já bloqueou em I/O e roda, em média,
+    // menos de ioBurst ciclos de pipeline entre bloqueios.
+    void setAsymmetric(bool on, uint64_t ioBurst = 40) { asymmetric = on; ioBurstCycles = ioBurst; }
+    bool isAsymmetric() const { return asymmetric; }
+    bool isIOBound(const PCB* p) const;
 };
 
@@ -0,0 +1,78 @@
+/*
+  core_loader.cpp
+  Implementação do carregamento dos perfis de core via JSON.
+*/
+#include "core_loader.hpp"
+#include <fstream>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+bool load_core_profiles_from_json(const std::string &path, std::vector<CoreProfile> &profiles) {
+    std::ifstream f(path);
+    if (!f.is_open()) {
+        std::cerr << "[core_loader] cannot open " << path << std::endl;
+        return false;
+    }
+
+    try {
+        json j;
+        f >> j;
+
+        if (!j.contains("cores") || !j["cores"].is_array()) {
+            std::cerr << "[core_loader] " << path << ": falta o array \"cores\"\n";
+            return false;
+        }
+
+        profiles.clear();
+        for (auto &c : j["cores"]) {
+            CoreProfile p;
+            p.name        = c.value("name", p.name);
+            p.coreClass   = c.value("class", std::string("big")) == "little"
+                                ? CoreClass::LITTLE : CoreClass::BIG;
+            p.count       = c.value("count", p.count);
+            p.clock       = c.value("clock", p.clock);
+            p.power       = c.value("power", p.power);
+            p.cacheCycles = c.value("cache_cycles", p.cacheCycles);
+
+            if (c.contains("issue")) {
+                auto &is = c["issue"];
+                p.issue.width    = is.value("width", p.issue.width);
+                p.issue.alus     = is.value("alus", p.issue.alus);
+                p.issue.memPorts = is.value("mem_ports", p.issue.memPorts);
+            }
+
+            if (c.contains("out_of_order")) {
+                auto &o = c["out_of_order"];
+                p.ooo.enabled    = o.value("enabled", true);
+                p.ooo.robEntries = o.value("rob", p.ooo.robEntries);
+                p.ooo.rsEntries  = o.value("rs", p.ooo.rsEntries);
+                p.ooo.lsqEntries = o.value("lsq", p.ooo.lsqEntries);
+            }
+
+            if (c.contains("smt")) {
+                auto &t = c["smt"];
+                p.smtContexts = t.value("contexts", p.smtContexts);
+                p.smtPolicy   = t.value("policy", std::string("icount")) == "rr"
+                                    ? SmtFetchPolicy::ROUND_ROBIN : SmtFetchPolicy::ICOUNT;
+            }
+
+            if (p.count == 0 || p.clock <= 0.0 || p.issue.width < 1) {
+                std::cerr << "[core_loader] " << path << ": perfil \"" << p.name
+                          << "\" inválido (count, clock e width devem ser positivos)\n";
+                return false;
+            }
+            profiles.push_back(p);
+        }
+
+        return !profiles.empty();
+    }
+    catch (const std::exception &ex) {
+        std::cerr << "[core_loader] error parsing " << path << " : " << ex.what() << "\n";
+        return false;
+    }
+    catch (...) {
+        return false;
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef CORE_LOADER_HPP
+#define CORE_LOADER_HPP
+/*
+  core_loader.hpp
+  Carrega a descrição de cores heterogêneos (big.LITTLE) de um JSON:
+
+  { "cores": [
+      { "name": "big", "class": "big", "count": 2, "clock": 1.5, "power": 3.0,
+        "cache_cycles": 1,
+        "issue": { "width": 2, "alus": 2, "mem_ports": 1 },
+        "out_of_order": { "enabled": true, "rob": 32, "rs": 16, "lsq": 16 },
+        "smt": { "contexts": 1, "policy": "icount" } },
+      ...
+  ] }
+
+  Campos ausentes ficam com o padrão de CoreProfile.
+*/
+#include <string>
+#include <vector>
+#include "Core.hpp"
+
+bool load_core_profiles_from_json(const std::string &path, std::vector<CoreProfile> &profiles);
+
+#endif // CORE_LOADER_HPP
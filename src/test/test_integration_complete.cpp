@@ -5,7 +5,9 @@
 #include <iostream>
 #include <cassert>
 #include <filesystem>
+#include <fstream>
 #include "cpu/pcb_loader.hpp"
+#include "multicore/core_loader.hpp"
 #include "multicore/MultiCore.hpp"
 #include "multicore/Scheduler.hpp"
 #include "memory/MemoryManager.hpp"
@@ -154,6 +156,189 @@ void test_Complete_System_Execution() {
     }
 }
 
+void test_Heterogeneous_Cores() {
+    std::cout << "\n=== TESTE: Cores Heterogêneos (big.LITTLE) ===\n";
+
+    // Perfis lidos de JSON (campos ausentes ficam no padrão)
+    std::string cfgFile = "test_cores.json";
+    {
+        std::ofstream f(cfgFile);
+        f << R"({ "cores": [
+            { "name": "big", "class": "big", "clock": 2.0, "power": 4.0,
+              "issue": { "width": 2, "alus": 2 } },
+            { "name": "little", "class": "little", "clock": 0.5, "power": 1.0,
+              "cache_cycles": 3 } ] })";
+    }
+    std::vector<CoreProfile> profiles;
+    assert(load_core_profiles_from_json(cfgFile, profiles));
+    fs::remove(cfgFile);
+    assert(profiles.size() == 2);
+    assert(profiles[0].coreClass == CoreClass::BIG && profiles[0].issue.width == 2);
+    assert(profiles[1].coreClass == CoreClass::LITTLE && profiles[1].cacheCycles == 3);
+    assert(profiles[1].count == 1 && profiles[1].issue.width == 1);
+
+    MemoryManager memManager(4096, 8192, 64);
+    memManager.createPartitions(512);
+    IOManager ioManager;
+    MultiCore multicore(profiles, &memManager, &ioManager, nullptr);
+    assert(multicore.numCores() == 2 && multicore.isHeterogeneous());
+
+    // Mesmo programa nos dois cores: o big (clock 2, largura 2) termina
+    // em bem menos ticks que o LITTLE (clock 0.5)
+    const uint32_t END = 0b11111100000000000000000000000000u;
+    PCB a; a.pid = 1; a.quantum = 1000;
+    PCB b; b.pid = 2; b.quantum = 1000;
+    for (PCB* p : {&a, &b}) {
+        memManager.allocateFixedPartition(*p, 100);
+        for (uint32_t i = 0; i < 8; i++)
+            memManager.writeLogical(i, (0x08u << 26) | (8u << 16) | (i + 1), *p);  // addi t0, zero, i+1
+        memManager.writeLogical(8, END, *p);
+    }
+
+    Scheduler scheduler(SchedPolicy::FCFS);
+    scheduler.add(&a);
+    scheduler.add(&b);
+    multicore.assignReadyProcesses([&](const Core &core) {
+        return scheduler.fetchNext(core.getNumaNode(), core.getCoreClass());
+    });
+
+    uint64_t finished[2] = {0, 0};
+    for (uint64_t tick = 1; tick < 500 && multicore.hasActiveCores(); tick++) {
+        for (auto &ev : multicore.stepAll())
+            if (ev.type == CoreEvent::FINISHED) finished[ev.pcb->pid - 1] = tick;
+    }
+    assert(finished[0] > 0 && finished[1] > 0);
+    assert(a.regBank.readRegister("t0") == 8 && b.regBank.readRegister("t0") == 8);
+    assert(a.pipeline_cycles.load() < b.pipeline_cycles.load() && "big despacha 2 por ciclo");
+    assert(finished[1] >= 4 * finished[0]);
+
+    const auto &cores = multicore.getCores();
+    assert(cores[0]->getEnergy() == 4.0 * cores[0]->getRunningTime());
+    assert(cores[1]->getIPC() > 0.0);
+
+    // Escalonador assimétrico: LITTLE pega o IO-bound, big o CPU-bound;
+    // sem processo da classe, qualquer um (core não fica ocioso)
+    PCB io; io.pid = 3;
+    io.io_blocks = 4;
+    io.pipeline_cycles = 40;        // 10 ciclos por rajada
+    PCB cpu; cpu.pid = 4;
+    cpu.pipeline_cycles = 400;
+    Scheduler sched(SchedPolicy::FCFS);
+    sched.setAsymmetric(true, 40);
+    assert(sched.isIOBound(&io) && !sched.isIOBound(&cpu));
+    sched.add(&io);
+    sched.add(&cpu);
+    assert(sched.fetchNext(-1, CoreClass::BIG) == &cpu);
+    sched.add(&cpu);
+    assert(sched.fetchNext(-1, CoreClass::LITTLE) == &io);
+    assert(sched.fetchNext(-1, CoreClass::LITTLE) == &cpu);
+
+    std::cout << "✓ big terminou no tick " << finished[0] << " (" << a.pipeline_cycles.load()
+              << " ciclos), LITTLE no tick " << finished[1] << " (" << b.pipeline_cycles.load()
+              << " ciclos)\n";
+    std::cout << "✓ big → CPU-bound, LITTLE → IO-bound\n";
+}
+
+void test_Interrupts() {
+    std::cout << "\n=== TESTE: Interrupções e Traps ===\n";
+
+    const uint32_t END = 0b11111100000000000000000000000000u;
+
+    // Quantum pelo timer do core: 8 ADDI em t0 com quantum 4, o processo
+    // volta ao core a cada preempção
+    auto run = [&](const InterruptConfig &cfg, PCB &p, int &preempted) {
+        MemoryManager memManager(4096, 8192, 64);
+        memManager.createPartitions(512);
+        IOManager ioManager;
+        MultiCore multicore(1, &memManager, &ioManager, nullptr);
+        multicore.configureInterrupts(cfg);
+
+        p.quantum = 4;
+        memManager.allocateFixedPartition(p, 100);
+        for (uint32_t i = 0; i < 8; i++)
+            memManager.writeLogical(i, (0x08u << 26) | (8u << 21) | (8u << 16) | 1, p);  // addi t0, t0, 1
+        memManager.writeLogical(8, END, p);
+
+        Scheduler scheduler(SchedPolicy::FCFS);
+        scheduler.add(&p);
+        preempted = 0;
+        uint64_t tick = 1;
+        for (; tick < 1000; tick++) {
+            multicore.assignReadyProcesses([&]() { return scheduler.fetchNext(); });
+            bool done = false;
+            for (auto &ev : multicore.stepAll()) {
+                if (ev.type == CoreEvent::PREEMPTED) { preempted++; scheduler.add(ev.pcb); }
+                if (ev.type == CoreEvent::FINISHED) done = true;
+            }
+            if (done) break;
+        }
+        InterruptController::CoreStats st;
+        if (multicore.getInterruptController())
+            st = multicore.getInterruptController()->getStats()[0];
+        return std::make_pair(tick, st);
+    };
+
+    InterruptConfig on;
+    on.enabled = true;
+    on.timerLatency = 5;
+
+    PCB a; a.pid = 1;
+    PCB b; b.pid = 2;
+    int pa = 0, pb = 0;
+    auto off = run(InterruptConfig(), a, pa);
+    auto irq = run(on, b, pb);
+
+    assert(a.regBank.readRegister("t0") == 8 && b.regBank.readRegister("t0") == 8);
+    assert(pa > 0 && pb > 0);
+    assert(off.second.total() == 0 && a.traps.load() == 0);
+    assert(irq.second.timer == static_cast<uint64_t>(pb) && b.traps.load() == irq.second.timer);
+    assert(irq.second.handlerCycles == 5 * irq.second.timer);
+    assert(b.interrupt_cycles.load() == irq.second.handlerCycles);
+    assert(irq.first > off.first);
+
+    // Vetor do timer: cr com IP7 e ExcCode 0; eret desligou EXL
+    assert(b.regBank.cr.read() == causeBits(TrapCause::INTERRUPT, CR_IP_TIMER));
+    assert((b.regBank.sr.read() & SR_EXL) == 0);
+
+    // Fim de I/O roteado para os cores: o tratador ocupa o core e devolve
+    // o processo em um evento IO_COMPLETE
+    MemoryManager memManager(4096, 8192, 64);
+    IOManager ioManager;
+    MultiCore multicore(2, &memManager, &ioManager, nullptr);
+    InterruptConfig io = on;
+    io.ioLatency = 3;
+    multicore.configureInterrupts(io);
+    InterruptController* ic = multicore.getInterruptController();
+
+    PCB x; x.pid = 3;
+    PCB y; y.pid = 4;
+    assert(ic->raiseIO(&x) == 0 && ic->raiseIO(&y) == 1);
+    assert(multicore.hasActiveCores());
+
+    std::vector<std::pair<int, PCB*>> done;
+    int ticks = 0;
+    while (multicore.hasActiveCores() && ticks < 10) {
+        ticks++;
+        for (auto &ev : multicore.stepAll())
+            if (ev.type == CoreEvent::IO_COMPLETE) done.push_back({ev.coreId, ev.pcb});
+    }
+    assert(ticks == 3 && done.size() == 2);
+    assert(done[0].first == 0 && done[0].second == &x);
+    assert(done[1].first == 1 && done[1].second == &y);
+    assert(ic->getStats()[0].io == 1 && ic->getStats()[1].handlerCycles == 3);
+    assert(x.interrupt_cycles.load() == 3);
+
+    // LAST_CORE: volta para o core onde o processo rodou
+    io.ioRouting = IoRouting::LAST_CORE;
+    multicore.configureInterrupts(io);
+    x.last_core = 1;
+    assert(multicore.getInterruptController()->raiseIO(&x) == 1);
+
+    std::cout << "✓ " << pb << " interrupções de timer (" << irq.second.handlerCycles
+              << " ciclos de tratador): " << off.first << " → " << irq.first << " ticks\n";
+    std::cout << "✓ fim de I/O atendido nos cores 0 e 1 em " << ticks << " ticks\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "  TESTE PRIORITÁRIO: INTEGRAÇÃO COMPLETA\n";
@@ -161,6 +346,8 @@ int main() {
     
     try {
         test_Complete_System_Execution();
+        test_Heterogeneous_Cores();
+        test_Interrupts();
         
         std::cout << "\n========================================\n";
         std::cout << "  ✓ TESTE DE INTEGRAÇÃO PASSOU\n";
@@ -6,6 +6,9 @@
 #include <cassert>
 #include <vector>
 #include <memory>
+#include <cstdio>
+#include <string>
+#include <sys/stat.h>
 #include "memory/MemoryManager.hpp"
 #include "cpu/PCB.hpp"
 
@@ -49,6 +52,19 @@ void test_Address_Translation() {
     uint32_t phys100 = memManager.resolveAddress(100, pcb);
     assert(phys100 == base + 100 && "Tradução deve somar base");
     
+    // Descritor de segmento no PCB (tradução O(1))
+    assert(pcb.segment.valid && pcb.segment.base == base && pcb.segment.limit == 512);
+
+    bool threw = false;
+    try { memManager.resolveAddress(512, pcb); } catch (const std::out_of_range &) { threw = true; }
+    assert(threw && "Limite do segmento deve ser verificado");
+
+    memManager.freePartition(pcb.pid);
+    assert(!pcb.segment.valid && "Liberar invalida o descritor");
+    threw = false;
+    try { memManager.resolveAddress(0, pcb); } catch (const std::runtime_error &) { threw = true; }
+    assert(threw && "Sem partição, sem tradução");
+
     std::cout << "✓ Lógico 0 → Físico " << phys0 << "\n";
     std::cout << "✓ Lógico 100 → Físico " << phys100 << "\n";
 }
@@ -131,6 +147,754 @@ void test_Memory_Full() {
     std::cout << "✓ Alocação adicional rejeitada (memória cheia)\n";
 }
 
+void test_Write_Policies() {
+    std::cout << "\n=== TESTE: Políticas de Escrita / Write Buffer ===\n";
+
+    // WRITE_BACK: stores ficam na cache, memória só recebe no flush
+    MemoryManager wb(4096, 8192, 64, CachePolicyType::FIFO,
+                     WritePolicy::WRITE_BACK, 4, 5);
+    PCB pcb;
+    pcb.pid = 1;
+    for (uint32_t i = 0; i < 10; i++)
+        wb.write(7, i, pcb);
+
+    assert(pcb.primary_mem_accesses.load() == 0 && "Write-back não deve ir à RAM em hits");
+    assert(pcb.memory_cycles.load() == 10 * pcb.memWeights.cache && "Custo deve ser só de cache");
+    assert(wb.read(7, pcb) == 9 && "Leitura deve ver o último valor");
+
+    // WRITE_THROUGH/no-allocate: escritas coalescem no write buffer
+    MemoryManager wt(4096, 8192, 64, CachePolicyType::FIFO,
+                     WritePolicy::WRITE_THROUGH, 4, 5);
+    PCB pcb2;
+    pcb2.pid = 2;
+    for (uint32_t i = 0; i < 10; i++)
+        wt.write(7, i, pcb2);
+
+    assert(wt.getWriteBuffer().size() == 1 && "Escritas no mesmo endereço devem coalescer");
+    assert(wt.getWriteBuffer().get_coalesced() == 9);
+    assert(wt.read(7, pcb2) == 9 && "Load deve ser encaminhado do write buffer");
+
+    // Drenagem em segundo plano
+    for (int t = 0; t < 5; t++) wt.tick();
+    assert(wt.getWriteBuffer().empty() && "Buffer deve drenar após drainInterval ciclos");
+
+    // Buffer cheio → stall cobrado do processo
+    for (uint32_t a = 0; a < 6; a++)
+        wt.write(100 + a, a, pcb2);
+    assert(wt.getWriteBuffer().get_fullStalls() == 2 && "Duas escritas devem encontrar o buffer cheio");
+    assert(pcb2.write_stall_cycles.load() == 2 * pcb2.memWeights.primary);
+
+    std::cout << "✓ Write-back: " << pcb.memory_cycles.load() << " ciclos para 10 stores\n";
+    std::cout << "✓ Write-through: coalescidas=" << wt.getWriteBuffer().get_coalesced()
+              << " stalls=" << wt.getWriteBuffer().get_fullStalls() << "\n";
+}
+
+void test_Victim_Cache_3C() {
+    std::cout << "\n=== TESTE: Victim Cache / Misses 3C ===\n";
+
+    // L1 FIFO com 2 linhas: 0,1,0,2,0 → o último 0 é miss de conflito
+    // (uma LRU totalmente associativa do mesmo tamanho acertaria)
+    MemoryManager mm(4096, 8192, 2, CachePolicyType::FIFO);
+    mm.setVictimCache(2);
+
+    PCB pcb;
+    pcb.pid = 1;
+    for (uint32_t a : {0u, 1u, 0u, 2u, 0u})
+        mm.read(a, pcb);
+
+    assert(pcb.miss_compulsory.load() == 3 && "0, 1 e 2 são compulsórios");
+    assert(pcb.miss_conflict.load() == 1 && "Último acesso a 0 é conflito");
+    assert(pcb.miss_capacity.load() == 0);
+    assert(pcb.victim_hits.load() == 1 && "Linha expulsa deve voltar da victim cache");
+    assert(mm.getVictimCache().get_hits() == 1);
+
+    // Varredura maior que a cache → misses de capacidade
+    PCB pcb2;
+    pcb2.pid = 2;
+    MemoryManager mm2(4096, 8192, 2, CachePolicyType::LRU);
+    for (int rep = 0; rep < 2; rep++)
+        for (uint32_t a = 10; a < 13; a++)
+            mm2.read(a, pcb2);
+
+    assert(pcb2.miss_compulsory.load() == 3);
+    assert(pcb2.miss_capacity.load() == 3 && "Reuso além da capacidade é miss de capacidade");
+    assert(pcb2.miss_conflict.load() == 0);
+
+    std::cout << "✓ Compulsórios=" << pcb.miss_compulsory.load()
+              << " conflito=" << pcb.miss_conflict.load()
+              << " victim hits=" << pcb.victim_hits.load() << "\n";
+    std::cout << "✓ Capacidade=" << pcb2.miss_capacity.load() << "\n";
+}
+
+void test_Stack_Distance_Curve() {
+    std::cout << "\n=== TESTE: Curva de Miss (Stack Distance) ===\n";
+
+    // Sequência pseudo-aleatória com localidade
+    std::vector<uint32_t> trace;
+    uint32_t x = 12345;
+    for (int i = 0; i < 2000; i++) {
+        x = x * 1103515245u + 12345u;
+        trace.push_back((x >> 16) % 40);
+    }
+
+    // A curva de uma única passada deve bater com uma L1 LRU real
+    for (size_t cap : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        MemoryManager mm(4096, 8192, cap, CachePolicyType::LRU);
+        mm.enableStackProfiler();
+
+        PCB pcb;
+        pcb.pid = 1;
+        for (uint32_t a : trace) mm.read(a, pcb);
+
+        const StackDistanceProfiler* sdp = mm.getStackProfiler();
+        assert(sdp->get_totalAccesses() == trace.size());
+        assert(sdp->hitsForCapacity(cap) == pcb.cache_hits.load() &&
+               "Hits previstos devem bater com a cache LRU");
+    }
+
+    // Compactação da árvore não pode alterar as distâncias
+    StackDistanceProfiler small(16);
+    StackDistanceProfiler big(4096);
+    for (uint32_t a : trace) { small.access(a); big.access(a); }
+    assert(small.getHistogram() == big.getHistogram());
+
+    std::cout << "✓ Curva de miss confere com LRU real para 6 capacidades\n";
+}
+
+void test_Memory_Trace_Roundtrip() {
+    std::cout << "\n=== TESTE: Trace Binário de Memória ===\n";
+
+    const std::string path = "test_mem_trace.bin";
+
+    {
+        MemoryManager mm(4096, 8192, 16);
+        assert(mm.enableTrace(path) && "Trace deve abrir");
+
+        PCB a; a.pid = 3;
+        PCB b; b.pid = 7;
+
+        mm.setCurrentCore(0);
+        for (uint32_t i = 0; i < 10000; i++) {
+            if (i % 3 == 0) mm.write(100 + (i % 50), i, a);
+            else            mm.read(200 + (i % 20), b, i % 2 == 0);
+            if (i % 100 == 0) mm.tick();
+            if (i == 5000) mm.setCurrentCore(2);
+        }
+        mm.closeTrace();
+    }
+
+    TraceReader reader(path);
+    assert(reader.is_open() && "Trace deve ser mapeado");
+
+    TraceRecord r;
+    uint64_t n = 0, lastTick = 0;
+    while (reader.next(r)) {
+        if (n % 3 == 0) {
+            assert(r.isWrite && r.pid == 3 && r.address == 100 + (n % 50));
+        } else {
+            assert(!r.isWrite && r.pid == 7 && r.address == 200 + (n % 20));
+            assert(r.isInstruction == (n % 2 == 0));
+        }
+        assert(r.core == (n <= 5000 ? 0 : 2));
+        assert(r.tick >= lastTick);
+        lastTick = r.tick;
+        n++;
+    }
+    assert(n == 10000 && "Todos os acessos devem ser lidos de volta");
+
+    std::cout << "✓ " << n << " registros em " << reader.size_bytes()
+              << " bytes (" << (double)reader.size_bytes() / n << " bytes/acesso)\n";
+
+    std::remove(path.c_str());
+}
+
+void test_Paging_TLB() {
+    std::cout << "\n=== TESTE: Paginação e TLB ===\n";
+
+    // 1024 words / páginas de 16 = 64 quadros
+    MemoryManager mm(1024, 2048, 16);
+    mm.createFrames(16);
+    mm.configureTLB(1, 4, 2, 0, 5);
+    assert(mm.getMode() == MemoryMode::PAGING);
+    assert(mm.getFrames().size() == 64);
+
+    // 10 processos pequenos cabem (com partições de 512 só caberiam 2)
+    std::vector<std::unique_ptr<PCB>> pcbs;
+    for (int i = 0; i < 10; i++) {
+        auto p = std::make_unique<PCB>();
+        p->pid = i + 1;
+        assert(mm.allocateProcess(*p, 40) && "Alocação paginada deve caber");
+        assert(p->pageTable.size() == 3);
+        pcbs.push_back(std::move(p));
+    }
+
+    PCB &a = *pcbs[0];
+    PCB &b = *pcbs[1];
+
+    // Mesmo endereço lógico → quadros diferentes por processo
+    mm.writeLogical(17, 111, a);
+    mm.writeLogical(17, 222, b);
+    mm.writeLogical(33, 7, a);
+    mm.writeLogical(34, 8, a);
+    assert(mm.resolveAddress(17, a) != mm.resolveAddress(17, b));
+    assert(mm.resolveAddress(17, a) % 16 == 1 && "Offset preservado");
+
+    // TLB: primeiro acesso no core 0 falha, o segundo acerta
+    mm.setCurrentCore(0);
+    uint64_t cyclesBefore = a.memory_cycles.load();
+    assert(mm.readLogical(33, a) == 7);
+    assert(a.tlb_misses.load() == 1);
+    assert(mm.readLogical(34, a) == 8);
+    assert(a.tlb_hits.load() == 1 && "Mesma página deve acertar na TLB");
+    assert(a.memory_cycles.load() - cyclesBefore >= 5);
+    assert(mm.readLogical(17, a) == 111);
+    assert(a.pageTable[1].referenced);
+    mm.writeLogical(18, 5, a);
+    assert(a.pageTable[1].dirty);
+
+    // Fora do espaço de endereçamento → page fault
+    bool threw = false;
+    try { mm.readLogical(48, a); } catch (const std::out_of_range &) { threw = true; }
+    assert(threw && a.page_faults.load() == 1);
+
+    // Liberar devolve os quadros e invalida a TLB do processo
+    double usageBefore = mm.usagePercent();
+    mm.freeProcess(a);
+    assert(a.pageTable.empty());
+    assert(mm.usagePercent() < usageBefore);
+    mm.setCurrentCore(-1);
+
+    std::cout << "✓ " << pcbs.size() << " processos paginados, TLB "
+              << mm.getTLBs()[0].get_hits() << " hits / "
+              << mm.getTLBs()[0].get_misses() << " misses\n";
+}
+
+void test_Demand_Paging() {
+    std::cout << "\n=== TESTE: Paginação sob Demanda (swap) ===\n";
+
+    const PageReplacementPolicy policies[] = {
+        PageReplacementPolicy::FIFO, PageReplacementPolicy::CLOCK,
+        PageReplacementPolicy::LRU_APPROX, PageReplacementPolicy::WSCLOCK,
+        PageReplacementPolicy::WORKING_SET
+    };
+
+    for (auto policy : policies) {
+        // 64 words / páginas de 16 = 4 quadros para 2 processos de 3 páginas
+        MemoryManager mm(64, 1024, 8);
+        mm.createFrames(16);
+        mm.configureTLB(1, 4, 4, 0, 5);
+        mm.enableDemandPaging(policy, 20, 4);
+
+        PCB a; a.pid = 1;
+        PCB b; b.pid = 2;
+        assert(mm.allocateProcess(a, 48) && mm.allocateProcess(b, 48));
+        assert(mm.usagePercent() == 0.0 && "Nada residente antes da 1ª falta");
+
+        // Carga (fora de um core) vai direto para o swap
+        for (uint32_t i = 0; i < 48; i++) {
+            mm.writeLogical(i, 1000 + i, a);
+            mm.writeLogical(i, 2000 + i, b);
+        }
+        assert(a.page_faults.load() == 0);
+
+        // Execução alternada: 6 páginas disputando 4 quadros
+        mm.setCurrentCore(0);
+        for (int round = 0; round < 3; round++) {
+            for (uint32_t i = 0; i < 48; i += 5) {
+                assert(mm.readLogical(i, a) == 1000 + i + (round > 0 && i == 20 ? 1 : 0));
+                assert(mm.readLogical(i, b) == 2000 + i);
+                mm.tick();
+            }
+            // Página suja precisa sobreviver ao page-out
+            if (round == 0) mm.writeLogical(20, 1021, a);
+        }
+        mm.setCurrentCore(-1);
+
+        assert(a.page_faults.load() > 3 && b.page_faults.load() > 3);
+        assert(a.page_fault_wait.load() > 0 && "Falta deve bloquear o processo");
+        if (policy == PageReplacementPolicy::WSCLOCK)
+            assert(a.pageTable[1].valid && "WSClock prefere expulsar páginas limpas");
+        else
+            assert(mm.get_pageOuts() >= 1 && "Página suja volta ao swap");
+        assert(mm.usagePercent() == 100.0);
+
+        // Espera pela página: processo libera depois de page_fault_wait ticks
+        mm.blockOnPageFault(&a);
+        assert(a.state == State::Blocked && mm.pageWaitingCount() == 1);
+        while (mm.pageWaitingCount() > 0) mm.tick();
+        auto ready = mm.takePageReady();
+        assert(ready.size() == 1 && ready[0] == &a);
+
+        mm.freeProcess(a);
+        mm.freeProcess(b);
+        assert(mm.usagePercent() == 0.0);
+
+        std::cout << "✓ política " << static_cast<int>(policy) << ": "
+                  << mm.get_pageIns() << " page-ins, "
+                  << mm.get_pageOuts() << " page-outs\n";
+    }
+}
+
+void test_Variable_Partitions_Buddy() {
+    std::cout << "\n=== TESTE: Partições Variáveis, Compactação e Buddy ===\n";
+
+    // Layout: P1[0,300) P2[300,350) P3[350,500) P4[500,550) P5[550,1024)
+    // Libera P1 e P3 → buracos de 300 (base 0) e 150 (base 350)
+    auto build = [](MemoryManager &mm, std::vector<std::unique_ptr<PCB>> &pcbs) {
+        const uint32_t sizes[] = {300, 50, 150, 50, 474};
+        for (int i = 0; i < 5; i++) {
+            auto p = std::make_unique<PCB>();
+            p->pid = i + 1;
+            assert(mm.allocateProcess(*p, sizes[i]));
+            pcbs.push_back(std::move(p));
+        }
+        mm.freeProcess(*pcbs[0]);
+        mm.freeProcess(*pcbs[2]);
+    };
+
+    const FitStrategy fits[] = {FitStrategy::FIRST_FIT, FitStrategy::BEST_FIT,
+                                FitStrategy::WORST_FIT};
+    const uint32_t expected[] = {0, 350, 0};
+    for (int f = 0; f < 3; f++) {
+        MemoryManager mm(1024, 2048, 16);
+        mm.createVariablePartitions(fits[f]);
+        std::vector<std::unique_ptr<PCB>> pcbs;
+        build(mm, pcbs);
+
+        PCB q; q.pid = 99;
+        assert(mm.allocateProcess(q, 120));
+        assert(q.partition_base == expected[f] && "Estratégia escolheu o buraco errado");
+    }
+
+    // Next-fit continua de onde parou
+    {
+        MemoryManager mm(1024, 2048, 16);
+        mm.createVariablePartitions(FitStrategy::NEXT_FIT);
+        std::vector<std::unique_ptr<PCB>> pcbs;
+        build(mm, pcbs);
+
+        PCB a; a.pid = 10;
+        PCB b; b.pid = 11;
+        PCB c; c.pid = 12;
+        assert(mm.allocateProcess(a, 120) && a.partition_base == 0);
+        assert(mm.allocateProcess(b, 100) && b.partition_base == 120);
+        mm.freeProcess(a);
+        assert(mm.allocateProcess(c, 100) && c.partition_base == 350
+               && "Next-fit não volta ao início da memória");
+    }
+
+    // Compactação: 450 livres em dois buracos, pedido de 400
+    {
+        MemoryManager mm(1024, 2048, 16);
+        mm.createVariablePartitions(FitStrategy::FIRST_FIT, true);
+        std::vector<std::unique_ptr<PCB>> pcbs;
+        build(mm, pcbs);
+
+        PCB &p2 = *pcbs[1];
+        mm.writeLogical(7, 4242, p2);
+
+        FragmentationStats before = mm.fragmentation();
+        assert(before.freeWords == 450 && before.holes == 2);
+        assert(before.external > 0.3 && before.external < 0.34);
+
+        uint64_t cyclesBefore = p2.memory_cycles.load();
+        PCB big; big.pid = 50;
+        assert(mm.allocateProcess(big, 400) && "Compactação deve abrir espaço");
+        assert(mm.get_compactions() == 1);
+        assert(p2.partition_base == 0 && "P2 relocado para o início");
+        assert(mm.readLogical(7, p2) == 4242 && "Conteúdo preservado na relocação");
+        assert(p2.memory_cycles.load() > cyclesBefore);
+        assert(mm.fragmentation().holes == 1);
+    }
+
+    // Buddy: blocos potência de 2, fusão completa ao liberar
+    {
+        MemoryManager mm(1024, 2048, 16);
+        mm.createBuddy(16);
+
+        PCB a; a.pid = 1;
+        PCB b; b.pid = 2;
+        PCB c; c.pid = 3;
+        assert(mm.allocateProcess(a, 100) && a.partition_size == 128 && a.partition_base == 0);
+        assert(mm.allocateProcess(b, 200) && b.partition_size == 256 && b.partition_base == 256);
+        assert(mm.allocateProcess(c, 30)  && c.partition_size == 32  && c.partition_base == 128);
+
+        FragmentationStats fs = mm.fragmentation();
+        assert(fs.internalWords == (128 - 100) + (256 - 200) + (32 - 30));
+        assert(fs.freeWords == 1024 - 128 - 256 - 32);
+
+        mm.writeLogical(5, 77, b);
+        assert(mm.readLogical(5, b) == 77);
+
+        PCB tooBig; tooBig.pid = 4;
+        assert(!mm.allocateProcess(tooBig, 600) && "Não há bloco de 1024 livre");
+
+        mm.freeProcess(a);
+        mm.freeProcess(c);
+        mm.freeProcess(b);
+        fs = mm.fragmentation();
+        assert(fs.holes == 1 && fs.largestHole == 1024 && "Buddies devem se fundir");
+        assert(mm.allocateProcess(tooBig, 600));
+    }
+
+    std::cout << "✓ first/best/worst/next-fit, compactação e buddy OK\n";
+}
+
+void test_Bulk_Load() {
+    std::cout << "\n=== TESTE: Carga em Bloco (DMA) ===\n";
+
+    MemoryManager mm(4096, 8192, 16);
+    mm.createPartitions(512);
+    mm.setDMACost(10, 4);
+
+    PCB a; a.pid = 1;
+    assert(mm.allocateFixedPartition(a, 300));
+
+    // Linha suja antiga na cache para um endereço que o DMA sobrescreve
+    mm.writeLogical(5, 999, a);
+    uint64_t writesBefore = a.mem_writes.load();
+    uint64_t missesBefore = a.cache_misses.load();
+
+    std::vector<uint32_t> code(300);
+    for (uint32_t i = 0; i < code.size(); i++) code[i] = 0xA000 + i;
+    mm.loadSegment(a, code);
+
+    assert(a.mem_writes.load() == writesBefore && "DMA não conta escritas do processo");
+    assert(a.cache_misses.load() == missesBefore && "DMA não passa pela cache");
+    assert(a.load_cycles.load() == 10 + 75 && mm.get_dmaCycles() == 85);
+
+    assert(mm.readLogical(5, a) == 0xA005 && "Linha antiga da cache invalidada");
+    assert(mm.readLogical(299, a) == 0xA000 + 299);
+
+    bool threw = false;
+    try { mm.loadSegment(a, code, 300); } catch (const std::out_of_range &) { threw = true; }
+    assert(threw && "Segmento além da partição");
+
+    // Paginação: transferência dividida por página (RAM e swap)
+    MemoryManager pm(64, 1024, 8);
+    pm.createFrames(16);
+    pm.enableDemandPaging(PageReplacementPolicy::CLOCK);
+    PCB b; b.pid = 2;
+    assert(pm.allocateProcess(b, 40));
+    std::vector<uint32_t> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    pm.loadSegment(b, data, 12);   // cruza a fronteira 16
+    pm.setCurrentCore(0);
+    assert(pm.readLogical(12, b) == 1 && pm.readLogical(21, b) == 10);
+    pm.setCurrentCore(-1);
+
+    std::cout << "✓ 300 palavras em 1 transferência (" << mm.get_dmaCycles() << " ciclos de DMA)\n";
+}
+
+void test_Secondary_Memory_Mmap() {
+    std::cout << "\n=== TESTE: Memória Secundária em Arquivo (mmap) ===\n";
+
+    const std::string path = "test_swap_backing.bin";
+    std::remove(path.c_str());
+
+    const size_t words = size_t(1) << 26;   // 256 MiB lógicos
+    {
+        SECONDARY_MEMORY sec(words, path);
+        assert(sec.isFileBacked() && sec.getSize() == words);
+
+        sec.WriteMem(static_cast<uint32_t>(words - 1), 0xBEEF);
+        uint32_t block[4] = {1, 2, 3, 4};
+        assert(sec.WriteBlock(1000000, block, 4));
+        assert(sec.ReadMem(static_cast<uint32_t>(words - 1)) == 0xBEEF);
+        sec.sync();
+    }
+
+    // Arquivo esparso: tamanho lógico cheio, quase nada alocado
+    struct stat st;
+    assert(stat(path.c_str(), &st) == 0);
+    assert(static_cast<size_t>(st.st_size) == words * sizeof(uint32_t));
+    assert(static_cast<size_t>(st.st_blocks) * 512 < (size_t(16) << 20));
+
+    // Persistência entre execuções
+    {
+        SECONDARY_MEMORY sec(words, path);
+        uint32_t back[4];
+        assert(sec.ReadBlock(1000000, back, 4) && back[3] == 4);
+        assert(sec.ReadMem(static_cast<uint32_t>(words - 1)) == 0xBEEF);
+    }
+
+    // Swap grande para paginação sob demanda
+    MemoryManager mm(64, 1024, 8);
+    assert(mm.useSecondaryBackingFile(path, words));
+    mm.createFrames(16);
+    mm.enableDemandPaging(PageReplacementPolicy::CLOCK);
+
+    PCB big; big.pid = 1;
+    assert(mm.allocateProcess(big, 100000) && "Processo maior que o swap em vetor");
+    mm.writeLogical(99999, 7, big);
+    mm.setCurrentCore(0);
+    assert(mm.readLogical(99999, big) == 7);
+    mm.setCurrentCore(-1);
+
+    std::cout << "✓ " << (words * 4 >> 20) << " MiB lógicos, "
+              << (st.st_blocks * 512 >> 10) << " KiB alocados no disco\n";
+    std::remove(path.c_str());
+}
+
+void test_Sparse_Main_Memory() {
+    std::cout << "\n=== TESTE: Memória Principal Esparsa ===\n";
+
+    const size_t words = size_t(1) << 26;   // 256 MiB de RAM simulada
+    MAIN_MEMORY ram(words);
+    assert(ram.getSize() == words);
+    assert(ram.get_residentChunks() == 0);
+
+    // Leitura/remoção de área nunca escrita não aloca
+    assert(ram.ReadMem(123456) == MEMORY_ACCESS_ERROR);
+    assert(ram.DeleteData(123456) == MEMORY_ACCESS_ERROR);
+    assert(ram.get_residentChunks() == 0);
+
+    ram.WriteMem(0, 11);
+    ram.WriteMem(static_cast<uint32_t>(words - 1), 22);
+
+    // Bloco atravessando a fronteira de dois pedaços
+    uint32_t block[10];
+    for (uint32_t i = 0; i < 10; ++i) block[i] = 100 + i;
+    assert(ram.WriteBlock(MAIN_MEMORY::CHUNK_WORDS - 4, block, 10));
+    assert(ram.get_residentChunks() == 3);
+
+    uint32_t back[12];
+    assert(ram.ReadBlock(MAIN_MEMORY::CHUNK_WORDS - 5, back, 12));
+    assert(back[0] == MEMORY_ACCESS_ERROR && back[1] == 100 && back[10] == 109);
+    assert(back[11] == MEMORY_ACCESS_ERROR);
+    assert(ram.ReadMem(0) == 11 && ram.ReadMem(static_cast<uint32_t>(words - 1)) == 22);
+    assert(ram.DeleteData(0) == 11 && ram.ReadMem(0) == MEMORY_ACCESS_ERROR);
+
+    // Paginação sobre uma RAM grande: só os quadros tocados ocupam o host
+    MemoryManager mm(words, 1024, 8);
+    mm.createFrames(1024);
+    PCB p; p.pid = 1;
+    assert(mm.allocateProcess(p, 4096));
+    mm.writeLogical(4000, 77, p);
+    assert(mm.readLogical(4000, p) == 77);
+    assert(mm.getMainMemory().get_residentBytes() <= 2 * 4096);
+
+    std::cout << "✓ " << (words * 4 >> 20) << " MiB simulados, "
+              << ram.get_residentBytes() / 1024 << " KiB residentes\n";
+}
+
+void test_Shared_Code() {
+    std::cout << "\n=== TESTE: Código Compartilhado ===\n";
+
+    std::vector<uint32_t> codeA(40), codeB(40);
+    for (uint32_t i = 0; i < 40; ++i) { codeA[i] = 1000 + i; codeB[i] = 2000 + i; }
+
+    auto makePCB = [](int pid, const std::vector<uint32_t> &code, uint32_t data) {
+        auto p = std::make_unique<PCB>();
+        p->pid = pid;
+        p->codeSegment = code;
+        p->code_bytes = static_cast<uint32_t>(code.size());
+        p->dataSegment.assign(data, 7);
+        p->data_bytes = data;
+        return p;
+    };
+
+    // Partições fixas: 3 processos com o mesmo CODE + 1 diferente
+    {
+        MemoryManager mm(1024, 1024, 8);
+        mm.createPartitions(128);
+        mm.enableSharedCode();
+
+        auto p1 = makePCB(1, codeA, 4), p2 = makePCB(2, codeA, 4);
+        auto p3 = makePCB(3, codeA, 0), p4 = makePCB(4, codeB, 4);
+        for (auto *p : {p1.get(), p2.get(), p3.get(), p4.get()})
+            assert(mm.loadProgram(*p));
+
+        assert(mm.get_sharedSegments() == 2);
+        assert(mm.get_sharedReuses() == 2 && mm.get_sharedWordsSaved() == 80);
+        assert(p1->initial_pc == 4 && p3->initial_pc == 0);
+
+        // Mesma cópia física; DATA continua privado
+        assert(mm.resolveAddress(4, *p1) == mm.resolveAddress(4, *p2));
+        assert(mm.resolveAddress(0, *p3) == mm.resolveAddress(4, *p1));
+        assert(mm.resolveAddress(0, *p1) != mm.resolveAddress(0, *p2));
+        assert(mm.readLogical(4 + 39, *p2, true) == 1039);
+        assert(mm.readLogical(4, *p4, true) == 2000);
+
+        // Código é somente leitura
+        bool threw = false;
+        try { mm.writeLogical(5, 1, *p1); } catch (const std::runtime_error&) { threw = true; }
+        assert(threw);
+
+        // 2 holders + 3 DATA privados; o último a sair libera o CODE
+        assert(mm.usagePercent() == 5.0 / 8.0 * 100.0);
+        mm.freeProcess(*p1);
+        mm.freeProcess(*p2);
+        assert(mm.get_sharedSegments() == 2);
+        mm.freeProcess(*p3);
+        mm.freeProcess(*p4);
+        assert(mm.get_sharedSegments() == 0 && mm.usagePercent() == 0.0);
+    }
+
+    // Paginação sob demanda com copy-on-write
+    {
+        MemoryManager mm(128, 1024, 8);
+        mm.createFrames(16);
+        mm.enableDemandPaging(PageReplacementPolicy::CLOCK);
+        mm.enableSharedCode(true);
+
+        auto p1 = makePCB(1, codeA, 16), p2 = makePCB(2, codeA, 16);
+        assert(mm.loadProgram(*p1) && mm.loadProgram(*p2));
+        assert(mm.get_sharedSegments() == 1 && p1->pageTable.size() == 4);
+
+        mm.setCurrentCore(0);
+        assert(mm.readLogical(16 + 20, *p1, true) == 1020);
+        assert(mm.readLogical(16 + 20, *p2, true) == 1020);
+        assert(mm.get_pageIns() == 1);   // uma falta serve os dois processos
+
+        mm.writeLogical(16 + 20, 99, *p2);
+        assert(mm.get_cowCopies() == 1);
+        assert(mm.readLogical(16 + 20, *p2) == 99);
+        assert(mm.readLogical(16 + 20, *p1, true) == 1020);
+        assert(mm.readLogical(16 + 21, *p2, true) == 1021);
+        mm.setCurrentCore(-1);
+
+        mm.freeProcess(*p1);
+        mm.freeProcess(*p2);
+        assert(mm.get_sharedSegments() == 0 && mm.usagePercent() == 0.0);
+    }
+
+    std::cout << "✓ CODE compartilhado em partições e páginas, COW OK\n";
+}
+
+void test_Memory_Bus() {
+    std::cout << "\n=== TESTE: Contenção no Barramento de Memória ===\n";
+
+    MemoryBusConfig cfg;
+    cfg.accessesPerCycle = 1;
+    cfg.banks = 2;
+    cfg.rowWords = 4;
+    cfg.rowHitCycles = 1;
+    cfg.rowMissCycles = 4;
+
+    MemoryBus bus(cfg, 2);
+    BusAccess a = bus.access(0, 0, 10);   // banco 0, linha 0
+    assert(a.queueCycles == 0 && !a.rowHit && a.rowPenalty == 3);
+    BusAccess b = bus.access(1, 1, 10);   // banco 1: espera 1 slot do barramento
+    assert(b.queueCycles == 1 && !b.rowHit);
+    BusAccess c = bus.access(2, 0, 10);   // banco 0 ocupado até 14; mesma linha
+    assert(c.queueCycles == 4 && c.rowHit && c.rowPenalty == 0);
+    BusAccess d = bus.access(8, 1, 20);   // banco 0, outra linha
+    assert(d.queueCycles == 0 && !d.rowHit);
+
+    auto t = bus.totals();
+    assert(t.requests == 4 && t.rowHits == 1 && t.rowMisses == 3);
+    assert(bus.get_coreStats()[0].queueCycles == 4);
+    assert(bus.get_coreStats()[1].queueCycles == 1);
+
+    // Dois cores errando na cache no mesmo ciclo: o segundo espera
+    MemoryManager mm(1024, 1024, 8);
+    mm.createPartitions(256);
+    mm.enableMemoryBus(cfg, 2);
+    PCB p1, p2;
+    p1.pid = 1; p2.pid = 2;
+    mm.setCurrentCore(0);
+    mm.read(0, p1);
+    mm.setCurrentCore(1);
+    mm.read(1, p2);
+    mm.setCurrentCore(-1);
+    assert(p1.bus_wait_cycles.load() == 3 && p2.bus_wait_cycles.load() == 4);
+    assert(p2.memory_cycles.load() == p1.memory_cycles.load() + 1);
+
+    std::cout << "✓ fila do barramento, bancos e row buffer conferem\n";
+}
+
+void test_Numa() {
+    std::cout << "\n=== TESTE: Memória NUMA ===\n";
+
+    // Partições fixas: 4 x 256 em 2 nós; o core 1 aloca no nó 1
+    MemoryManager mm(1024, 1024, 8);
+    mm.createPartitions(256);
+    mm.enableNuma(2, NumaPlacement::FIRST_TOUCH, 0, 10);
+    mm.setCoreNode(0, 0);
+    mm.setCoreNode(1, 1);
+
+    PCB a; a.pid = 1;
+    mm.setCurrentCore(1);
+    Partition* part = mm.allocateFixedPartition(a, 100);
+    assert(part && part->base == 512 && a.numa_home == 1);
+
+    // Leitura do próprio nó é local; a do core 0 é remota e mais cara
+    mm.readLogical(0, a);
+    uint64_t localCycles = a.memory_cycles.load();
+    mm.setCurrentCore(0);
+    mm.readLogical(200, a);
+    mm.setCurrentCore(-1);
+    assert(a.numa_local_accesses.load() == 1 && a.numa_remote_accesses.load() == 1);
+    assert(a.memory_cycles.load() - localCycles == localCycles + 10);
+
+    // Paginação intercalada: páginas alternam entre os nós
+    MemoryManager pm(1024, 1024, 8);
+    pm.createFrames(64);
+    pm.enableNuma(2, NumaPlacement::INTERLEAVED);
+    PCB b; b.pid = 2;
+    assert(pm.allocateProcess(b, 256));
+    for (uint32_t v = 0; v < 4; v++) {
+        int node = pm.getNuma()->nodeOf(b.pageTable[v].frame * 64);
+        assert(node == static_cast<int>((b.numa_home + v) % 2));
+    }
+
+    // Sob demanda + first-touch: o quadro vai para o nó do core da falta
+    MemoryManager dm(1024, 1024, 8);
+    dm.createFrames(64);
+    dm.configureTLB(2, 4, 4, 0, 5);
+    dm.enableDemandPaging(PageReplacementPolicy::FIFO, 20, 4);
+    dm.enableNuma(2, NumaPlacement::FIRST_TOUCH);
+    dm.setCoreNode(0, 0);
+    dm.setCoreNode(1, 1);
+    PCB c; c.pid = 3;
+    assert(dm.allocateProcess(c, 128));
+    dm.setCurrentCore(1);
+    dm.readLogical(0, c);
+    dm.setCurrentCore(0);
+    dm.readLogical(64, c);
+    dm.setCurrentCore(-1);
+    assert(c.pageTable[0].valid && dm.getNuma()->nodeOf(c.pageTable[0].frame * 64) == 1);
+    assert(c.pageTable[1].valid && dm.getNuma()->nodeOf(c.pageTable[1].frame * 64) == 0);
+
+    std::cout << "✓ posicionamento por nó e custo local/remoto conferem\n";
+}
+
+void test_Cache_Heatmap() {
+    std::cout << "\n=== TESTE: Mapa de Calor da Cache ===\n";
+
+    // L1 de 2 linhas, 2 partições de 128, buckets de 64, janelas de 10
+    MemoryManager mm(256, 1024, 2);
+    mm.createPartitions(128);
+    mm.enableCacheHeatmap(64, 10);
+
+    PCB a; a.pid = 1;
+    PCB b; b.pid = 2;
+    assert(mm.allocateFixedPartition(a, 100) && mm.allocateFixedPartition(b, 100));
+
+    mm.read(0, a);      // miss
+    mm.read(0, a);      // hit
+    mm.read(1, a);      // miss
+    for (int i = 0; i < 10; i++) mm.tick();
+    mm.read(128, b);    // miss na janela 1: expulsa o endereço 0 (FIFO)
+
+    const CacheHeatmap* hm = mm.getCacheHeatmap();
+    assert(hm->get_numBuckets() == 5 && hm->get_numWindows() == 2);
+    assert(hm->at(0, 0).hits == 1 && hm->at(0, 0).misses == 2);
+    assert(hm->at(1, 2).misses == 1);
+    assert(hm->at(1, 0).evictions == 1 && "Expulsão conta no bucket da linha expulsa");
+    auto parts = hm->ownerTotals();
+    assert(parts[b.partition_id].evictions == 1 && "...e na partição que a provocou");
+    assert(hm->hottest(1)[0].bucket == 0);
+    assert(hm->thrashing(5).size() == 1 && hm->thrashing(5)[0].bucket == 0);
+    assert(mm.getCache()->get_evictions() == 1);
+
+    // Por conjunto: endereço % sets
+    CacheHeatmap sets(1024, 64, 10, 4);
+    assert(sets.get_numBuckets() == 4 && sets.bucketOf(5) == 1 && sets.bucketOf(1024) == 0);
+
+    std::cout << "✓ hits/misses/expulsões por bucket, janela e partição\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "  TESTES PRIORITÁRIOS: MEMÓRIA\n";
@@ -141,6 +905,20 @@ int main() {
         test_Address_Translation();
         test_Cache_Hit_Miss();
         test_Memory_Full();
+        test_Write_Policies();
+        test_Victim_Cache_3C();
+        test_Stack_Distance_Curve();
+        test_Memory_Trace_Roundtrip();
+        test_Paging_TLB();
+        test_Demand_Paging();
+        test_Variable_Partitions_Buddy();
+        test_Bulk_Load();
+        test_Secondary_Memory_Mmap();
+        test_Sparse_Main_Memory();
+        test_Shared_Code();
+        test_Memory_Bus();
+        test_Numa();
+        test_Cache_Heatmap();
         
         std::cout << "\n========================================\n";
         std::cout << "  ✓ TODOS OS TESTES DE MEMÓRIA PASSARAM\n";
@@ -4,12 +4,17 @@
  */
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include "multicore/MultiCore.hpp"
 #include "multicore/Scheduler.hpp"
 #include "memory/MemoryManager.hpp"
 #include "IO/IOManager.hpp"
 #include "cpu/PCB.hpp"
 #include "metrics/Metrics.hpp"
+#include "metrics/MetricsExtended.hpp"
 
 void test_PCB_Metrics() {
     std::cout << "\n=== TESTE: Métricas do PCB ===\n";
@@ -212,6 +217,185 @@ void test_System_Metrics() {
     std::cout << "✓ Métricas do sistema coletadas\n";
 }
 
+// Roda 8 ADDI num core com o governor dado; devolve os ticks até o fim
+static uint64_t run_with_energy(const EnergyConfig &cfg, PCB &pcb, EnergyMeter::Stats &st) {
+    MemoryManager memManager(4096, 8192, 64);
+    memManager.createPartitions(512);
+    IOManager ioManager;
+    MultiCore multicore(1, &memManager, &ioManager, nullptr);
+    multicore.configureEnergy(cfg);
+
+    pcb.quantum = 1000;
+    memManager.allocateFixedPartition(pcb, 100);
+    for (uint32_t i = 0; i < 8; i++)
+        memManager.writeLogical(i, (0x08u << 26) | (8u << 16) | (i + 1), pcb);   // addi t0, zero, i+1
+    memManager.writeLogical(8, 0b11111100000000000000000000000000u, pcb);
+
+    assert(multicore.getCores()[0]->assignProcess(&pcb));
+
+    uint64_t tick = 0;
+    while (multicore.hasActiveCores() && tick < 500) {
+        multicore.stepAll();
+        tick++;
+    }
+    st = multicore.getCores()[0]->getEnergyMeter().getStats();
+    assert(std::fabs(multicore.totalEnergyNj() - st.totalNj()) < 1e-9);
+    return tick;
+}
+
+void test_Energy_DVFS() {
+    std::cout << "\n=== TESTE: Energia e DVFS ===\n";
+
+    // Governor ondemand: janela ociosa desce um nível, com transição
+    EnergyConfig cfg;
+    cfg.enabled = true;
+    cfg.governor = DvfsGovernor::ONDEMAND;
+    cfg.window = 4;
+    EnergyMeter m(cfg, 1.0);
+    assert(m.getLevel() == 2 && m.frequency() == 1.0);
+    for (int i = 0; i < 4; i++) m.tick(false);
+    assert(m.getLevel() == 1 && m.getStats().transitions == 1);
+    assert(m.frequency() == 0.0 && "core parado durante a troca");
+    m.tick(false);
+    m.tick(false);
+    assert(m.frequency() == 0.75);
+    m.onInstruction(InstrClass::MULDIV);
+    assert(std::fabs(m.getStats().dynamicNj - 3.0 * 0.9 * 0.9) < 1e-9);
+    for (int i = 0; i < 4; i++) m.tick(true);
+    assert(m.getLevel() == 2 && m.getStats().transitions == 2);
+    assert(std::fabs(m.getStats().leakageNj - m.getStats().idleLeakageNj - 4 * 0.2 * 0.9) < 1e-9);
+
+    // Mesmo programa: powersave leva mais ticks e gasta menos por instrução
+    EnergyMeter::Stats fast, slow;
+    PCB a; a.pid = 1;
+    PCB b; b.pid = 2;
+    cfg.governor = DvfsGovernor::PERFORMANCE;
+    uint64_t tFast = run_with_energy(cfg, a, fast);
+    cfg.governor = DvfsGovernor::POWERSAVE;
+    uint64_t tSlow = run_with_energy(cfg, b, slow);
+
+    assert(a.regBank.readRegister("t0") == 8 && b.regBank.readRegister("t0") == 8);
+    assert(fast.instructions[static_cast<size_t>(InstrClass::ALU)] == 8);
+    assert(tSlow >= 2 * tFast - 1);
+    assert(std::fabs(fast.dynamicNj - 8.0) < 1e-9);
+    assert(std::fabs(slow.dynamicNj - 8.0 * 0.8 * 0.8) < 1e-9);
+    assert(fast.memoryNj > 0 && std::fabs(fast.memoryNj - slow.memoryNj) < 1e-9);
+
+    // policy_metrics: joules e EDP
+    auto pm = MetricsExtended::calculatePolicyMetrics({}, SchedPolicy::FCFS, tFast, 1,
+                                                      fast.totalNj() * 1e-9, 1e-9);
+    assert(std::fabs(pm.edp - fast.totalNj() * 1e-9 * tFast * 1e-9) < 1e-24);
+
+    std::cout << "✓ performance: " << tFast << " ticks, " << fast.totalNj() << " nJ; powersave: "
+              << tSlow << " ticks, " << slow.totalNj() << " nJ\n";
+}
+
+// Laço de 5 voltas num core com o perfil ligado (código a partir do PC 0)
+static void run_profiled(PCB &pcb, int quantum) {
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    const uint32_t T0 = 8, T1 = 9, T2 = 10;
+    std::vector<uint32_t> loop = {
+        addi(T0, 0, 0),
+        addi(T1, 0, 5),
+        addi(T0, T0, 1),                                                       // 2: alvo
+        (0x05u << 26) | (T0 << 21) | (T1 << 16) | static_cast<uint16_t>(-3),  // 3: bne t0, t1
+        addi(T2, 0, 9),
+        0b11111100000000000000000000000000u
+    };
+
+    MemoryManager memManager(4096, 8192, 64);
+    memManager.createPartitions(512);
+    IOManager ioManager;
+    MultiCore multicore(1, &memManager, &ioManager, nullptr);
+
+    pcb.quantum = quantum;
+    pcb.profile.enable(0, 5);
+    memManager.allocateFixedPartition(pcb, 100);
+    for (size_t i = 0; i < loop.size(); i++)
+        memManager.writeLogical(static_cast<uint32_t>(i), loop[i], pcb);
+
+    Scheduler scheduler(SchedPolicy::FCFS);
+    scheduler.add(&pcb);
+    for (int tick = 0; tick < 500 && pcb.state != State::Finished; tick++) {
+        multicore.assignReadyProcesses([&]() { return scheduler.fetchNext(); });
+        for (auto &ev : multicore.stepAll())
+            if (ev.type == CoreEvent::PREEMPTED) scheduler.add(ev.pcb);
+    }
+    assert(pcb.state == State::Finished);
+}
+
+void test_Instruction_Profile() {
+    std::cout << "\n=== TESTE: Perfil de Instruções (hotspots) ===\n";
+
+    std::vector<std::unique_ptr<PCB>> pcbs;
+    pcbs.push_back(std::make_unique<PCB>());
+    pcbs.push_back(std::make_unique<PCB>());
+    PCB &a = *pcbs[0];
+    PCB &b = *pcbs[1];
+    a.pid = 1; a.name = "laco";
+    b.pid = 2; b.name = "laco preemptado";
+    run_profiled(a, 1000);
+    run_profiled(b, 3);
+    assert(a.regBank.readRegister("t0") == 5 && a.regBank.readRegister("t2") == 9);
+
+    // Mix por classe: 8 ADDI e 5 BNE; o END não executa
+    const auto &mix = a.profile.getMix();
+    assert(mix[static_cast<size_t>(InstrClass::ALU)] == 8);
+    assert(mix[static_cast<size_t>(InstrClass::BRANCH)] == 5);
+    assert(a.profile.getOutside() == 0);
+
+    // Blocos: o alvo do BNE (PC 2) corta o bloco [0-1]; o laço é o mais quente
+    auto blocks = a.profile.hotBlocks();
+    assert(blocks.size() == 3);
+    assert(blocks[0].start == 2 && blocks[0].end == 3);
+    assert(blocks[0].executions == 5 && blocks[0].instructions == 10);
+    for (size_t i = 1; i < blocks.size(); i++)
+        assert(blocks[i - 1].cycles() >= blocks[i].cycles());
+
+    auto pcs = a.profile.hotPcs();
+    assert(pcs.size() == 5);
+    assert(pcs[0].pc == 2 || pcs[0].pc == 3);
+
+    // Preempções no meio do laço não mudam contagens nem blocos
+    auto bb = b.profile.hotBlocks();
+    assert(bb.size() == blocks.size());
+    for (size_t i = 0; i < bb.size(); i++) {
+        bool found = false;
+        for (const auto &x : blocks)
+            found |= x.start == bb[i].start && x.end == bb[i].end && x.instructions == bb[i].instructions;
+        assert(found);
+    }
+
+    // Relatórios: hotspots e pilhas "folded" (processo;bloco;PC ciclos)
+    auto reports = Metrics::collect(pcbs);
+    assert(reports[0].profiled && reports[0].hot_blocks.front().start == 2);
+    Metrics::saveHotspotReport(reports, "test_hotspots.txt");
+    Metrics::saveFoldedStacks(reports, "test_profile.folded");
+
+    std::ifstream folded("test_profile.folded");
+    std::string line;
+    size_t lines = 0;
+    bool loopLine = false;
+    while (std::getline(folded, line)) {
+        lines++;
+        assert(std::count(line.begin(), line.end(), ' ') == 1);
+        loopLine |= line.rfind("laco_pid1;bb_2_3;pc_3_branch ", 0) == 0;
+        if (line.rfind("laco_preemptado_pid2;", 0) != 0) assert(line.rfind("laco_pid1;", 0) == 0);
+    }
+    assert(lines == 10 && loopLine);
+    std::ifstream hot("test_hotspots.txt");
+    std::getline(hot, line);
+    assert(line.rfind("PID 1 (laco)", 0) == 0);
+    std::remove("test_hotspots.txt");
+    std::remove("test_profile.folded");
+
+    std::cout << "✓ bloco quente PC " << blocks[0].start << "-" << blocks[0].end << ": "
+              << blocks[0].executions << " execuções, " << blocks[0].cycles() << " ciclos; "
+              << lines << " pilhas para o flamegraph\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "  TESTES DE MÉTRICAS\n";
@@ -222,6 +406,8 @@ int main() {
         test_Memory_Metrics();
         test_Pipeline_Metrics();
         test_System_Metrics();
+        test_Energy_DVFS();
+        test_Instruction_Profile();
         
         std::cout << "\n========================================\n";
         std::cout << "  ✓ TODOS OS TESTES DE MÉTRICAS PASSARAM\n";
@@ -39,7 +39,7 @@ void test_Pipeline_Throughput() {
     for (uint32_t i = 0; i < pcb.data_bytes; i++)
         memManager.writeLogical(i, 0, pcb);
     for (uint32_t i = 0; i < num_instructions; i++)
-        memManager.writeLogical(pcb.data_bytes + i, 0x00000000 + (i % 10), pcb);
+        memManager.writeLogical(pcb.data_bytes + i, 0x00000000 + (i % 8), pcb); // funct 8 = JR
     
     // Sentinel de fim
     uint32_t END_SENTINEL = 0b11111100000000000000000000000000u;
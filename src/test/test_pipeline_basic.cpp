@@ -4,6 +4,7 @@
  */
 #include <iostream>
 #include <cassert>
+#include <vector>
 #include "multicore/Core.hpp"
 #include "memory/MemoryManager.hpp"
 #include "IO/IOManager.hpp"
@@ -95,6 +96,462 @@ void test_Pipeline_Stages() {
     std::cout << "✓ Eventos são gerados corretamente\n";
 }
 
+// Roda o programa num core com o preditor dado até terminar (reatribuindo
+// o processo a cada preempção). Devolve as instruções executadas pelo core
+static uint64_t run_program(const std::vector<uint32_t> &code, PCB &pcb,
+                            BranchPredictorType type, bool forwarding = true,
+                            const std::vector<std::pair<uint32_t, uint32_t>> &data = {},
+                            const IssueConfig &issue = IssueConfig(),
+                            const OutOfOrderConfig &ooo = OutOfOrderConfig(),
+                            int quantum = 1000,
+                            OutOfOrderEngine::Stats *oooStats = nullptr) {
+    MemoryManager memManager(4096, 8192, 64);
+    IOManager ioManager;
+    bool printLock = false;
+    Core core(0, &memManager, &ioManager, &printLock);
+
+    BranchPredictorConfig cfg;
+    cfg.type = type;
+    core.configureBranchPredictor(cfg);
+    core.setForwarding(forwarding);
+    core.configureIssue(issue);
+    core.configureOutOfOrder(ooo);
+
+    pcb.quantum = quantum;
+    memManager.createPartitions(512);
+    memManager.allocateFixedPartition(pcb, 100);
+    for (size_t i = 0; i < code.size(); i++)
+        memManager.writeLogical(static_cast<uint32_t>(i), code[i], pcb);
+    for (auto &d : data)
+        memManager.writeLogical(d.first, d.second, pcb);
+
+    assert(core.assignProcess(&pcb));
+    for (int cycles = 0; cycles < 500; cycles++) {
+        CoreEvent ev = core.stepOneCycle();
+        if (ev.type == CoreEvent::PREEMPTED)
+            assert(core.assignProcess(&pcb));
+        if (ev.type == CoreEvent::FINISHED) {
+            if (oooStats && core.getOutOfOrder()) *oooStats = core.getOutOfOrder()->getStats();
+            return core.instructions_executed;
+        }
+    }
+    assert(false && "Programa deve terminar");
+    return 0;
+}
+
+void test_Branch_Prediction() {
+    std::cout << "\n=== TESTE: Predição de Desvios ===\n";
+
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    const uint32_t T0 = 8, T1 = 9, RA = 31;
+    const uint32_t END = 0b11111100000000000000000000000000u;
+
+    // Unidade: bimodal aprende o laço, gshare aprende alternância
+    BranchPredictorConfig cfg;
+    cfg.type = BranchPredictorType::BIMODAL;
+    BranchPredictor bim(cfg);
+    for (int i = 0; i < 3; i++) {
+        BranchPrediction p = bim.predict(7, BranchKind::CONDITIONAL);
+        bim.update(7, BranchKind::CONDITIONAL, p, true, 2);
+    }
+    BranchPrediction p = bim.predict(7, BranchKind::CONDITIONAL);
+    assert(p.taken && p.btbHit && p.target == 2);
+
+    cfg.type = BranchPredictorType::GSHARE;
+    BranchPredictor gsh(cfg);
+    int wrong = 0;
+    for (int i = 0; i < 40; i++) {
+        bool taken = (i % 2 == 0);
+        BranchPrediction q = gsh.predict(9, BranchKind::CONDITIONAL);
+        if (i >= 20 && q.taken != taken) wrong++;
+        gsh.update(9, BranchKind::CONDITIONAL, q, taken, 3);
+    }
+    assert(wrong == 0 && "gshare separa T/N alternados pelo histórico");
+
+    // Laço de 5 voltas: t0 += 1 até t0 == t1 (alvo = PC + 2 + imm)
+    std::vector<uint32_t> loop = {
+        addi(T0, 0, 0),
+        addi(T1, 0, 5),
+        addi(T0, T0, 1),                                          // 2: loop
+        (0x05u << 26) | (T0 << 21) | (T1 << 16) | static_cast<uint16_t>(-3), // 3: bne → 2
+        0, 0,
+        END
+    };
+    PCB s; s.pid = 1;
+    run_program(loop, s, BranchPredictorType::STATIC_NOT_TAKEN);
+    PCB t; t.pid = 2;
+    run_program(loop, t, BranchPredictorType::TOURNAMENT);
+
+    assert(s.regBank.readRegister("t0") == 5 && t.regBank.readRegister("t0") == 5);
+    assert(s.branches.load() == 5 && s.branch_mispredictions.load() == 4);
+    assert(t.branch_mispredictions.load() < s.branch_mispredictions.load());
+    assert(t.pipeline_cycles.load() < s.pipeline_cycles.load());
+    assert(t.branch_flush_cycles.load() == 2 * t.branch_mispredictions.load());
+
+    // JAL/JR: o retorno sai do RAS mesmo na primeira chamada
+    std::vector<uint32_t> call = {
+        addi(T1, 0, 0),
+        (0x03u << 26) | 4,                  // 1: jal 4
+        addi(T1, T1, 10),                   // 2: volta aqui
+        END,
+        addi(T1, T1, 1),                    // 4: função
+        (RA << 21) | 0x08,                  // 5: jr ra
+        0, 0
+    };
+    PCB c; c.pid = 3;
+    run_program(call, c, BranchPredictorType::TOURNAMENT);
+    assert(c.regBank.readRegister("t1") == 11);
+    assert(c.branches.load() == 2 && c.branch_mispredictions.load() == 1);
+
+    std::cout << "✓ laço: " << s.branch_mispredictions.load() << " → "
+              << t.branch_mispredictions.load() << " erros, "
+              << s.pipeline_cycles.load() << " → " << t.pipeline_cycles.load()
+              << " ciclos; JR previsto pelo RAS\n";
+}
+
+void test_Data_Hazards() {
+    std::cout << "\n=== TESTE: Hazards de Dados ===\n";
+
+    const uint32_t T0 = 8, T1 = 9, T2 = 10, T3 = 11;
+    auto add = [](uint32_t rd, uint32_t rs, uint32_t rt) {
+        return (rs << 21) | (rt << 16) | (rd << 11) | 0x20;
+    };
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+
+    std::vector<uint32_t> code = {
+        (0x23u << 26) | (T0 << 16) | 400,   // lw t0, 400 (palavra 100)
+        add(T1, T0, T0),                    // load-use
+        addi(T2, T1, 1),                    // EX/MEM
+        0,
+        add(T3, T1, T2),                    // t2 pelo MEM/WB
+        0b11111100000000000000000000000000u
+    };
+    std::vector<std::pair<uint32_t, uint32_t>> data = {{100, 7}};
+
+    PCB f; f.pid = 1;
+    run_program(code, f, BranchPredictorType::STATIC_NOT_TAKEN, true, data);
+    PCB n; n.pid = 2;
+    run_program(code, n, BranchPredictorType::STATIC_NOT_TAKEN, false, data);
+
+    assert(f.regBank.readRegister("t3") == 29 && n.regBank.readRegister("t3") == 29);
+    assert(f.stall_load_use_cycles.load() == 1 && f.stall_raw_cycles.load() == 0);
+    assert(f.forwards_ex_mem.load() == 1 && f.forwards_mem_wb.load() == 3);
+
+    // Sem encaminhamento: 2 + 2 bolhas (distância 1) e 1 (distância 2)
+    assert(n.stall_raw_cycles.load() == 5);
+    assert(n.pipeline_cycles.load() - f.pipeline_cycles.load() == 4);
+
+    std::cout << "✓ load-use com 1 bolha; sem forwarding " << n.stall_raw_cycles.load()
+              << " bolhas (" << f.pipeline_cycles.load() << " → "
+              << n.pipeline_cycles.load() << " ciclos)\n";
+}
+
+void test_Superscalar_Issue() {
+    std::cout << "\n=== TESTE: Despacho Superescalar ===\n";
+
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    auto lw = [](uint32_t rt, uint16_t byteAddr) {
+        return (0x23u << 26) | (rt << 16) | byteAddr;
+    };
+    const uint32_t END = 0b11111100000000000000000000000000u;
+    const auto NT = BranchPredictorType::STATIC_NOT_TAKEN;
+
+    // 8 ADDI independentes (t0..t7) e a mesma quantidade encadeada em t0
+    std::vector<uint32_t> indep, chain, mixed;
+    for (uint32_t r = 0; r < 8; r++) {
+        indep.push_back(addi(8 + r, 0, static_cast<int16_t>(r + 1)));
+        chain.push_back(addi(8, 8, 1));
+        mixed.push_back(r % 2 ? addi(8 + r, 0, 1) : lw(8 + r, 400));
+    }
+    indep.push_back(END);
+    chain.push_back(END);
+    mixed.push_back(END);
+
+    IssueConfig scalar;
+    IssueConfig dual;
+    dual.width = 2;
+    dual.alus = 2;
+    dual.memPorts = 1;
+    IssueConfig dualOneAlu = dual;
+    dualOneAlu.alus = 1;
+
+    hw::RegisterMapper names;
+    auto cycles = [&](const std::vector<uint32_t> &code, const IssueConfig &cfg,
+                      int reg, int expected) {
+        PCB p; p.pid = 1;
+        uint64_t n = run_program(code, p, NT, true, {{100, 5}}, cfg);
+        assert(n == 8);
+        assert(static_cast<int>(p.regBank.readRegister(names.getRegisterName(reg))) == expected);
+        return p.pipeline_cycles.load();
+    };
+
+    uint64_t s1 = cycles(indep, scalar, 15, 8);
+    uint64_t s2 = cycles(indep, dual, 15, 8);
+    uint64_t s3 = cycles(indep, dualOneAlu, 15, 8);
+    assert(s1 == 13 && s2 == 10);   // enchimento/drenagem continuam escalares
+    assert(s3 == s1);   // uma ALU: o grupo nunca passa de 1 ADDI
+
+    // Cadeia de dependências: largura não ajuda
+    uint64_t c1 = cycles(chain, scalar, 8, 8);
+    uint64_t c2 = cycles(chain, dual, 8, 8);
+    assert(c2 == c1);
+
+    // LW + ADDI alternados cabem em 1 porta de memória + ALU
+    uint64_t m1 = cycles(mixed, scalar, 14, 5);
+    uint64_t m2 = cycles(mixed, dual, 14, 5);
+    assert(m2 == s2 && m1 == s1);
+
+    std::cout << "✓ independentes " << s1 << " → " << s2 << " ciclos, cadeia "
+              << c1 << " → " << c2 << ", LW/ADDI " << m1 << " → " << m2 << "\n";
+}
+
+void test_Out_Of_Order() {
+    std::cout << "\n=== TESTE: Execução Fora de Ordem ===\n";
+
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    auto add = [](uint32_t rd, uint32_t rs, uint32_t rt) {
+        return (rs << 21) | (rt << 16) | (rd << 11) | 0x20;
+    };
+    const uint32_t T0 = 8, T1 = 9, T2 = 10, T7 = 15;
+    const uint32_t END = 0b11111100000000000000000000000000u;
+    const auto NT = BranchPredictorType::STATIC_NOT_TAKEN;
+    const auto TOUR = BranchPredictorType::TOURNAMENT;
+
+    IssueConfig dual;
+    dual.width = 2;
+    dual.alus = 2;
+    OutOfOrderConfig ooo;
+    ooo.enabled = true;
+    ooo.robEntries = 16;
+
+    // LW longo seguido de trabalho independente; o consumidor vem no fim
+    std::vector<uint32_t> code = { (0x23u << 26) | (T0 << 16) | 400 };
+    for (uint32_t r = 1; r <= 6; r++)
+        code.push_back(addi(T0 + r, 0, static_cast<int16_t>(r)));
+    code.push_back(add(T7, T0, T1));
+    code.push_back((0x2Bu << 26) | (T7 << 16) | 404);   // sw t7, 404
+    code.push_back((0x23u << 26) | (T2 << 16) | 404);   // lw t2, 404 (do LSQ)
+    code.push_back(END);
+    std::vector<std::pair<uint32_t, uint32_t>> data = {{100, 40}};
+
+    // Acesso à cache caro: o load leva 8 ciclos no backend fora de ordem
+    PCB in; in.pid = 1;
+    in.memWeights.cache = 8;
+    uint64_t nIn = run_program(code, in, NT, true, data, dual);
+    PCB out; out.pid = 2;
+    out.memWeights.cache = 8;
+    OutOfOrderEngine::Stats st;
+    uint64_t nOut = run_program(code, out, NT, true, data, dual, ooo, 1000, &st);
+
+    assert(nIn == 10 && nOut == 10 && st.committed == 10);
+    assert(out.regBank.readRegister("t7") == 41 && out.regBank.readRegister("t2") == 41);
+    for (const char* r : {"t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7"})
+        assert(out.regBank.readRegister(r) == in.regBank.readRegister(r));
+    assert(st.storeForwards == 1);
+    assert(st.loadLatency == 8 && st.headMemStallCycles < st.loadLatency);
+
+    // Desvios mal previstos descartam o caminho errado; com quantum 3 o
+    // processo é preemptado várias vezes e o estado no PCB segue preciso
+    std::vector<uint32_t> loop = {
+        addi(T0, 0, 0),
+        addi(T1, 0, 5),
+        addi(T0, T0, 1),
+        (0x05u << 26) | (T0 << 21) | (T1 << 16) | static_cast<uint16_t>(-3),
+        addi(T2, 0, 9),
+        END
+    };
+    PCB l; l.pid = 3;
+    OutOfOrderEngine::Stats ls;
+    run_program(loop, l, TOUR, true, {}, dual, ooo, 1000, &ls);
+    assert(l.regBank.readRegister("t0") == 5 && l.regBank.readRegister("t2") == 9);
+    assert(l.branches.load() == 5 && l.branch_mispredictions.load() >= 1);
+    assert(ls.squashed > 0);
+
+    PCB q; q.pid = 4;
+    run_program(loop, q, TOUR, true, {}, dual, ooo, 3);
+    assert(q.regBank.readRegister("t0") == 5 && q.regBank.readRegister("t2") == 9);
+
+    std::cout << "✓ LW de " << st.loadLatency << " ciclos com " << st.headMemStallCycles
+              << " expostos; " << in.pipeline_cycles.load() << " → " << out.pipeline_cycles.load()
+              << " ciclos; " << ls.squashed << " descartadas no laço\n";
+}
+
+// Dois processos no mesmo core com 2 contextos SMT: devolve os ciclos do
+// core até os dois terminarem
+static int run_smt(const std::vector<uint32_t> &code, PCB &a, PCB &b,
+                   SmtFetchPolicy policy, const IssueConfig &issue,
+                   const OutOfOrderConfig &ooo, std::vector<Core::ContextStats> &stats) {
+    MemoryManager memManager(4096, 8192, 64);
+    IOManager ioManager;
+    bool printLock = false;
+    Core core(0, &memManager, &ioManager, &printLock);
+    core.configureIssue(issue);
+    core.configureOutOfOrder(ooo);
+    core.configureSMT(2, policy);
+
+    memManager.createPartitions(512);
+    for (PCB* p : {&a, &b}) {
+        p->quantum = 1000;
+        memManager.allocateFixedPartition(*p, 100);
+        for (size_t i = 0; i < code.size(); i++)
+            memManager.writeLogical(static_cast<uint32_t>(i), code[i], *p);
+    }
+
+    assert(core.assignProcess(&a) && core.assignProcess(&b));
+    assert(!core.hasFreeContext());
+    int finished = 0;
+    for (int cycles = 1; cycles < 500; cycles++) {
+        for (const CoreEvent &ev : core.stepCycle())
+            if (ev.type == CoreEvent::FINISHED) finished++;
+        if (finished == 2) {
+            assert(core.isIdle());
+            stats = core.getContextStats();
+            return cycles;
+        }
+    }
+    assert(false && "Os dois processos devem terminar");
+    return 0;
+}
+
+void test_SMT() {
+    std::cout << "\n=== TESTE: Multithreading Simultâneo (SMT) ===\n";
+
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    const uint32_t END = 0b11111100000000000000000000000000u;
+
+    // Cadeia de dependências: sozinho o processo não usa a 2ª via
+    std::vector<uint32_t> chain;
+    for (int i = 0; i < 8; i++) chain.push_back(addi(8, 8, 1));
+    chain.push_back(END);
+
+    IssueConfig dual;
+    dual.width = 2;
+    dual.alus = 2;
+
+    PCB solo; solo.pid = 1;
+    run_program(chain, solo, BranchPredictorType::STATIC_NOT_TAKEN, true, {}, dual);
+    uint64_t alone = solo.pipeline_cycles.load();
+
+    for (SmtFetchPolicy policy : {SmtFetchPolicy::ROUND_ROBIN, SmtFetchPolicy::ICOUNT}) {
+        PCB a; a.pid = 2;
+        PCB b; b.pid = 3;
+        std::vector<Core::ContextStats> st;
+        int cycles = run_smt(chain, a, b, policy, dual, OutOfOrderConfig(), st);
+
+        assert(a.regBank.readRegister("t0") == 8 && b.regBank.readRegister("t0") == 8);
+        assert(static_cast<uint64_t>(cycles) < 2 * alone && "contextos dividem as vias");
+        assert(st.size() == 2);
+        assert(st[0].issued + st[1].issued >= 16);
+        std::cout << "✓ " << (policy == SmtFetchPolicy::ICOUNT ? "ICOUNT" : "round-robin")
+                  << ": 2 × " << alone << " ciclos → " << cycles << " (contexto 0 despachou "
+                  << st[0].issued << ", contexto 1 " << st[1].issued << ")\n";
+    }
+
+    // Fora de ordem: ROB por contexto, estado de cada processo preciso
+    OutOfOrderConfig ooo;
+    ooo.enabled = true;
+    PCB a; a.pid = 4;
+    PCB b; b.pid = 5;
+    std::vector<Core::ContextStats> st;
+    int cycles = run_smt(chain, a, b, SmtFetchPolicy::ICOUNT, dual, ooo, st);
+    assert(a.regBank.readRegister("t0") == 8 && b.regBank.readRegister("t0") == 8);
+    std::cout << "✓ fora de ordem com 2 contextos: " << cycles << " ciclos\n";
+}
+
+// Um processo sozinho com quantum curto, voltando ao core a cada
+// preempção: devolve os ciclos do core até terminar
+static int run_switching(const std::vector<uint32_t> &code, PCB &pcb,
+                         const ContextSwitchConfig &cfg, int quantum) {
+    MemoryManager memManager(4096, 8192, 64);
+    IOManager ioManager;
+    bool printLock = false;
+    Core core(0, &memManager, &ioManager, &printLock);
+    core.configureContextSwitch(cfg);
+
+    pcb.quantum = quantum;
+    memManager.createPartitions(512);
+    memManager.allocateFixedPartition(pcb, 100);
+    for (size_t i = 0; i < code.size(); i++)
+        memManager.writeLogical(static_cast<uint32_t>(i), code[i], pcb);
+
+    assert(core.assignProcess(&pcb));
+    for (int cycles = 1; cycles < 2000; cycles++) {
+        CoreEvent ev = core.stepOneCycle();
+        if (ev.type == CoreEvent::PREEMPTED) {
+            assert(core.isIdle());
+            core.assignProcess(&pcb);
+        }
+        if (ev.type == CoreEvent::FINISHED) {
+            assert(core.context_switches == pcb.context_switches.load());
+            return cycles;
+        }
+    }
+    assert(false && "O processo deve terminar");
+    return 0;
+}
+
+void test_Context_Switch_Cost() {
+    std::cout << "\n=== TESTE: Custo da Troca de Contexto ===\n";
+
+    auto addi = [](uint32_t rt, uint32_t rs, int16_t imm) {
+        return (0x08u << 26) | (rs << 21) | (rt << 16) | static_cast<uint16_t>(imm);
+    };
+    const uint32_t END = 0b11111100000000000000000000000000u;
+
+    // Só t0 é escrito: o salvamento lazy guarda 1 GPR + 6 especiais
+    std::vector<uint32_t> chain;
+    for (int i = 0; i < 8; i++) chain.push_back(addi(8, 8, 1));
+    chain.push_back(END);
+
+    ContextSwitchConfig off;
+    ContextSwitchConfig eager;
+    eager.enabled = true;
+    eager.warmupAccesses = 4;
+    eager.warmupCycles = 3;
+    ContextSwitchConfig lazy = eager;
+    lazy.lazyRegisters = true;
+
+    PCB a; a.pid = 1;
+    PCB b; b.pid = 2;
+    PCB c; c.pid = 3;
+    int base = run_switching(chain, a, off, 4);
+    int full = run_switching(chain, b, eager, 4);
+    int light = run_switching(chain, c, lazy, 4);
+
+    for (PCB* p : {&a, &b, &c}) {
+        assert(p->regBank.readRegister("t0") == 8);
+        assert(p->context_switches.load() == a.context_switches.load());
+        assert(p->switch_drain_cycles.load() > 0);
+    }
+    assert(a.context_switches.load() > 0);
+    assert(a.context_switch_cycles.load() == 0 && a.warmup_cycles.load() == 0);
+
+    // Eager: 38 ciclos para restaurar e 38 para salvar a cada volta
+    uint64_t n = b.context_switches.load();
+    assert(b.context_switch_cycles.load() == 38 * (2 * n + 1));
+    assert(full == base + static_cast<int>(b.context_switch_cycles.load()));
+
+    // Lazy: mesmo processo volta ao contexto sem restaurar
+    assert(c.context_switch_cycles.load() == 38 + 7 * n);
+    assert(light > base && light < full);
+
+    // Warm-up só na primeira entrada (contexto vinha de outro processo)
+    assert(b.warmup_cycles.load() == 4 * 3 && c.warmup_cycles.load() == 4 * 3);
+
+    std::cout << "✓ " << n << " trocas: " << base << " ciclos sem custo, " << full
+              << " eager, " << light << " lazy\n";
+}
+
 int main() {
     std::cout << "========================================\n";
     std::cout << "  TESTES PRIORITÁRIOS: PIPELINE\n";
@@ -103,6 +560,12 @@ int main() {
     try {
         test_Pipeline_Execution();
         test_Pipeline_Stages();
+        test_Branch_Prediction();
+        test_Data_Hazards();
+        test_Superscalar_Issue();
+        test_Out_Of_Order();
+        test_SMT();
+        test_Context_Switch_Cost();
         
         std::cout << "\n========================================\n";
         std::cout << "  ✓ TODOS OS TESTES DO PIPELINE PASSARAM\n";